@@ -281,6 +281,31 @@ int msg_send_to_self(msg_t *m);
  */
 int msg_send_int(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send several messages to a thread at once.
+ *
+ * Delivers the messages in @p m in order, with interrupts disabled only once:
+ * if the target is waiting in msg_receive() it gets the first message
+ * directly, the others are put into its queue. The target is woken up at most
+ * once. Messages that do not fit into the target's queue are sent like with
+ * msg_send(), i.e. the caller blocks until the target took them.
+ *
+ * If called from an interrupt, this function never blocks and only delivers
+ * as many messages as the target can take right now.
+ *
+ * ``m[i].sender_pid`` is set for every delivered message.
+ *
+ * @param[in] m             Array of @p num preallocated ``msg_t``
+ *                          structures, must not be NULL.
+ * @param[in] num           Number of messages to send.
+ * @param[in] target_pid    PID of target thread.
+ *
+ * @return number of messages delivered, @p num unless called from an
+ *         interrupt or sending to the calling thread
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Test if the message was sent inside an ISR.
  * @see msg_send_int()
@@ -318,6 +343,24 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive several messages at once.
+ *
+ * Blocks until at least one message can be received, then takes up to @p max
+ * messages from the queue and from blocked senders with interrupts disabled
+ * only once. All senders that got unblocked are scheduled with a single
+ * context switch.
+ *
+ * Messages are returned in the order msg_receive() would return them.
+ *
+ * @param[out] buf  Array of @p max preallocated ``msg_t`` structures, must
+ *                  not be NULL.
+ * @param[in]  max  Maximum number of messages to receive, must not be 0.
+ *
+ * @return  number of messages received, at least 1.
+ */
+int msg_receive_batch(msg_t *buf, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
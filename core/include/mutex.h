@@ -16,7 +16,13 @@
  *              employed. If your application is subject to priority inversion
  *              and cannot tolerate the additional delay this can cause, use
  *              module `core_mutex_priority_inheritance` to employ
- *              priority inheritance as mitigation.
+ *              priority inheritance as mitigation. The owner of a mutex then
+ *              runs at the priority of the highest priority waiter. If the
+ *              owner itself waits for another mutex, the boost is passed on
+ *              along the chain of owners. On unlock, the owner drops to the
+ *              highest priority of the threads still waiting for mutexes it
+ *              holds, or to its priority before it was boosted, so mutexes
+ *              held at the same time can be unlocked in any order.
  *
  * Mutex Implementation Basics
  * ===========================
@@ -173,14 +179,6 @@ typedef struct {
      */
     uinttxtptr_t owner_calling_pc;
 #endif
-#if defined(DOXYGEN) || defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    /**
-     * @brief   Original priority of the owner
-     * @note    Only available if module core_mutex_priority_inheritance
-     *          is used.
-     */
-    uint8_t owner_original_priority;
-#endif
 } mutex_t;
 
 /**
@@ -216,6 +214,44 @@ typedef struct {
     uint8_t cancelled;  /**< Flag whether the mutex has been cancelled */
 } mutex_cancel_t;
 
+#if !defined(CONFIG_MUTEX_SPIN_MIN) || defined(DOXYGEN)
+/**
+ * @brief   Number of polls @ref mutex_lock_adaptive spins at least before it
+ *          blocks
+ */
+#define CONFIG_MUTEX_SPIN_MIN   8
+#endif
+
+#if !defined(CONFIG_MUTEX_SPIN_MAX) || defined(DOXYGEN)
+/**
+ * @brief   Number of polls @ref mutex_lock_adaptive spins at most before it
+ *          blocks
+ */
+#define CONFIG_MUTEX_SPIN_MAX   512
+#endif
+
+/**
+ * @brief   Spin state for use with @ref mutex_lock_adaptive
+ *
+ * The state can be shared by all users of a mutex. It is updated without
+ * synchronization, as it only holds statistics.
+ */
+typedef struct {
+    uint32_t avg;       /**< moving average of the polls needed to obtain the
+                             mutex, in 1/16 polls */
+    unsigned spun;      /**< number of times the mutex was obtained spinning */
+    unsigned blocked;   /**< number of times the spin budget was exceeded */
+} mutex_spin_t;
+
+#ifndef __cplusplus
+/**
+ * @brief Static initializer for mutex_spin_t.
+ */
+#  define MUTEX_SPIN_INIT { .avg = 0 }
+#else
+#  define MUTEX_SPIN_INIT {}
+#endif /* __cplusplus */
+
 #ifndef __cplusplus
 /**
  * @brief Static initializer for mutex_t.
@@ -322,6 +358,41 @@ static inline void mutex_lock(mutex_t *mutex)
 #endif
 }
 
+/**
+ * @brief   Locks a mutex, spinning for a while before blocking.
+ *
+ * If the mutex is held, the mutex is polled with interrupts enabled before the
+ * calling thread blocks. When the mutex is released in time, this saves the two
+ * context switches of blocking. The number of polls is
+ * @ref CONFIG_MUTEX_SPIN_MIN plus twice the moving average of the polls needed
+ * before, limited to @ref CONFIG_MUTEX_SPIN_MAX. A lock that had to block
+ * counts as needing all the polls it made, so the budget follows the hold
+ * times of the mutex.
+ *
+ * On a single core only an interrupt can release the mutex while the caller
+ * spins. This pays off for mutexes used to wait for short operations completed
+ * in an ISR. For mutexes held by other threads it only costs up to
+ * @ref CONFIG_MUTEX_SPIN_MAX polls, unless other threads are already waiting:
+ * then the caller blocks right away, as the mutex is handed to them first.
+ *
+ * @param[in,out]   mutex   Mutex object to lock.
+ * @param[in,out]   spin    Spin state of @p mutex
+ *
+ * @pre     @p mutex and @p spin are not `NULL`
+ * @pre     Must be called in thread context
+ *
+ * @post    The mutex @p is locked and held by the calling thread.
+ */
+#if (MAXTHREADS > 1) || DOXYGEN
+void mutex_lock_adaptive(mutex_t *mutex, mutex_spin_t *spin);
+#else
+static inline void mutex_lock_adaptive(mutex_t *mutex, mutex_spin_t *spin)
+{
+    (void)spin;
+    mutex_lock(mutex);
+}
+#endif
+
 /**
  * @brief   Locks a mutex, blocking. This function can be canceled.
  *
@@ -247,10 +247,49 @@ extern volatile thread_t *sched_threads[KERNEL_PID_LAST + 1];
  */
 extern volatile int sched_num_threads;
 
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY) || defined(DOXYGEN)
+/**
+ * @brief   Runqueue of one priority level as used by the sched_runq_array
+ *          module
+ *
+ * The pids of the runnable threads are kept in a ring in FIFO order, the
+ * thread control blocks are looked up in @ref sched_threads. Unlike the
+ * default lists threaded through the thread control blocks, selecting the
+ * next thread and removing the first one touches neither the thread stacks
+ * nor other runqueue members. This costs `SCHED_PRIO_LEVELS * (MAXTHREADS + 2)`
+ * bytes of RAM instead of a pointer per priority level.
+ *
+ * @warning This API is not intended for out of tree users.
+ */
+typedef struct {
+    uint8_t head;               /**< slot of the first thread               */
+    uint8_t count;              /**< number of threads in the runqueue      */
+    uint8_t pids[MAXTHREADS];   /**< ring of the pids of the threads        */
+} sched_runq_t;
+
+/**
+ * Runqueues per priority level
+ */
+extern sched_runq_t sched_runqueues[SCHED_PRIO_LEVELS];
+
+/**
+ * @brief   Wrap a slot index of a runqueue ring
+ *
+ * @internal
+ *
+ * @param[in]   slot    slot index, at most `2 * MAXTHREADS - 1`
+ * @return      @p slot wrapped into `[0, MAXTHREADS)`
+ */
+static inline unsigned _sched_runq_slot(unsigned slot)
+{
+    return (slot >= MAXTHREADS) ? slot - MAXTHREADS : slot;
+}
+#else
 /**
  * List of runqueues per priority level
  */
 extern clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
+#endif
 
 /**
  * @brief  Removes thread from scheduler and set status to #STATUS_STOPPED
@@ -322,9 +361,53 @@ void sched_register_cb(sched_callback_t callback);
  */
 static inline void sched_runq_advance(uint8_t prio)
 {
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    sched_runq_t *runq = &sched_runqueues[prio];
+
+    if (runq->count) {
+        uint8_t pid = runq->pids[runq->head];
+        runq->head = _sched_runq_slot(runq->head + 1);
+        runq->pids[_sched_runq_slot(runq->head + runq->count - 1)] = pid;
+    }
+#else
     clist_lpoprpush(&sched_runqueues[prio]);
+#endif
 }
 
+/**
+ * @brief   Get the first thread of a runqueue
+ *
+ * This is the thread that gets activated next time that priority is
+ * scheduled.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @pre     The runqueue of @p prio is not empty
+ *
+ * @param   prio      The priority of the runqueue
+ * @return  The first thread of the runqueue
+ */
+thread_t *sched_runq_head(uint8_t prio);
+
+/**
+ * @brief   Move a thread to the front of its runqueue
+ *
+ * The order of the other threads of the runqueue is kept.
+ *
+ * @note    This functions expects interrupts to be disabled when called!
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @pre     @p thread is on the runqueue of its priority
+ *
+ * @param   thread    The thread to move
+ */
+void sched_runq_move_to_front(thread_t *thread);
+
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK)) || defined(DOXYGEN)
 /**
  * @brief   Scheduler runqueue (change) callback
@@ -345,6 +428,80 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if IS_USED(MODULE_SCHED_FEEDBACK) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler run accounting hook of the feedback scheduler
+ *
+ * @details Function is provided by the sched_feedback module.
+ *          It is called at the beginning of every scheduler run, before the
+ *          next thread is selected, and charges @p active with the time it
+ *          ran since the last call. It may change the status of threads,
+ *          but must not change priorities and has to take constant time.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   active    the thread that was running, may be NULL
+ */
+extern void sched_feedback_account(thread_t *active);
+
+/**
+ * @brief   Runqueue hook of the feedback scheduler
+ *
+ * @details Function is provided by the sched_feedback module.
+ *          It is called whenever @p thread entered the runqueue of @p prio,
+ *          so a thread running on a higher feedback level can be made to
+ *          share the CPU. It has to take constant time.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread that entered a runqueue
+ * @param   prio      the priority of that runqueue
+ */
+extern void sched_feedback_runq_push(thread_t *thread, uint8_t prio);
+#endif
+
+#if IS_USED(MODULE_SCHED_TRACE) || defined(DOXYGEN)
+/**
+ * @brief   Context switch hook of the scheduler tracer
+ *
+ * @details Function is provided by the sched_trace module.
+ *          It is called by the scheduler whenever it switches to another
+ *          thread or resumes a thread after the CPU was idle, before the
+ *          status of @p prev is changed.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   prev      the thread that was running, may be NULL
+ * @param   next      the thread that runs next
+ */
+extern void sched_trace_switch(thread_t *prev, thread_t *next);
+#endif
+
+#if IS_USED(MODULE_SCHED_BUDGET) || defined(DOXYGEN)
+/**
+ * @brief   Context switch hook of the CPU time budgets
+ *
+ * @details Function is provided by the sched_budget module.
+ *          It is called by the scheduler whenever the running thread changes,
+ *          including when the CPU goes idle and resumes without an idle
+ *          thread. It charges the thread that ran so far and arms the budget
+ *          timer of @p next.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   next      the thread that runs next, NULL if the CPU goes idle
+ */
+extern void sched_budget_switch(thread_t *next);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
@@ -354,7 +511,11 @@ extern void sched_runq_callback(uint8_t prio);
  */
 static inline int sched_runq_is_empty(uint8_t prio)
 {
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    return sched_runqueues[prio].count == 0;
+#else
     return clist_is_empty(&sched_runqueues[prio]);
+#endif
 }
 
 /**
@@ -366,7 +527,11 @@ static inline int sched_runq_is_empty(uint8_t prio)
  */
 static inline int sched_runq_exactly_one(uint8_t prio)
 {
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    return sched_runqueues[prio].count == 1;
+#else
     return clist_exactly_one(&sched_runqueues[prio]);
+#endif
 }
 
 /**
@@ -378,14 +543,22 @@ static inline int sched_runq_exactly_one(uint8_t prio)
  */
 static inline int sched_runq_more_than_one(uint8_t prio)
 {
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    return sched_runqueues[prio].count > 1;
+#else
     return clist_more_than_one(&sched_runqueues[prio]);
+#endif
 }
 
 /*********************************************************************************/
 /* FUNZIONE CREATA PER CONTARE ESATTAMENTE I PROCESSI IN CODA*/
 static inline int sched_count_processes(uint8_t prio)
 {
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    return sched_runqueues[prio].count;
+#else
     return clist_count(&sched_runqueues[prio]);
+#endif
 }
 /*********************************************************************************/
 
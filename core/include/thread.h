@@ -210,11 +210,12 @@ struct _thread {
 #ifdef HAVE_THREAD_ARCH_T
     thread_arch_t arch;             /**< architecture dependent part    */
 #endif
-
-
-	int service_time;
-
-
+#if defined(MODULE_SCHED_FEEDBACK) || defined(DOXYGEN)
+    int service_time;               /**< remaining service time in units of
+                                         SCHED_FEEDBACK_TIMERBASE, the
+                                         thread is stopped once it is used
+                                         up. 0 if unlimited             */
+#endif
 };
 
 /**
@@ -246,6 +247,41 @@ struct _thread {
 #define THREAD_CREATE_STACKTEST         (8)
 /** @} */
 
+/**
+ * @brief   Scheduling policies a thread can be created with
+ */
+typedef enum {
+    THREAD_SCHED_PRIO,              /**< fixed priority, the default     */
+    THREAD_SCHED_FEEDBACK,          /**< multilevel feedback scheduling,
+                                         requires module sched_feedback  */
+} thread_sched_policy_t;
+
+/**
+ * @brief   Optional attributes of a new thread
+ *
+ * Setting an attribute whose module is not part of the build makes
+ * @ref thread_create_ext fail with -ENOTSUP.
+ */
+typedef struct {
+    thread_sched_policy_t policy;   /**< scheduling policy               */
+    uint8_t level;                  /**< initial feedback level, used
+                                         instead of the priority with
+                                         @ref THREAD_SCHED_FEEDBACK, from
+                                         SCHED_FEEDBACK_LEVEL_FIRST to
+                                         SCHED_FEEDBACK_LEVEL_LAST       */
+    int service_time;               /**< service time in units of
+                                         SCHED_FEEDBACK_TIMERBASE, the
+                                         thread is stopped once it is used
+                                         up, requires module
+                                         sched_feedback. 0 if unlimited  */
+    uint32_t budget;                /**< CPU time in microseconds the
+                                         thread may use per period,
+                                         requires module sched_budget.
+                                         0 if unlimited                  */
+    uint32_t period;                /**< period of the budget in
+                                         microseconds                    */
+} thread_attr_t;
+
 /**
  * @brief Creates a new thread.
  *
@@ -278,22 +314,43 @@ kernel_pid_t thread_create(char *stack,
                            void *arg,
                            const char *name);
 
-
-/********************************************************************************************
-* FUNZIONE CREATA APPOSITAMENTE PER LO SCHEDULING FEEDBACK, SI TRATTA
-* DI UNA COPIA DI THREAD_CREATE MA CON L'AGGIUNTA DI UN SERVICE TIME.
-********************************************************************************************/
-#if IS_USED(MODULE_SCHED_FEEDBACK)
-kernel_pid_t thread_create_feedback(char *stack,
-                           int stacksize,
-                           uint8_t priority,
-                           int flags,
-                           thread_task_func_t task_func,
-                           void *arg,
-                           const char *name,
-			   int ser_time);
-#endif
-/*******************************************************************************************/
+/**
+ * @brief Creates a new thread with additional attributes.
+ *
+ * Same as @ref thread_create, with the scheduler specific parameters of the
+ * thread taken from @p attr. With @ref THREAD_SCHED_FEEDBACK, the thread
+ * starts at the feedback level thread_attr_t::level and @p priority is
+ * ignored.
+ *
+ * @param[out] stack    start address of the preallocated stack memory
+ * @param[in] stacksize the size of the thread's stack in bytes
+ * @param[in] priority  priority of the new thread, lower mean higher priority,
+ *                      ignored with @ref THREAD_SCHED_FEEDBACK
+ * @param[in] flags     optional flags for the creation of the new thread
+ * @param[in] task_func pointer to the code that is executed in the new thread
+ * @param[in] arg       the argument to the function
+ * @param[in] name      a human readable descriptor for the thread
+ * @param[in] attr      attributes of the new thread, NULL for the defaults
+ *
+ * @return              PID of newly created task on success
+ * @return              -EINVAL, if the priority is greater than or equal to
+ *                      @ref SCHED_PRIO_LEVELS
+ * @return              -EINVAL, if the feedback level in @p attr is not a
+ *                      level of the feedback scheduler
+ * @return              -ENOTSUP, if the scheduling policy, the service time
+ *                      or the CPU time budget in @p attr is not available
+ * @return              -EINVAL, if the budget in @p attr exceeds its period
+ * @return              -ENOMEM, if there is no room for another CPU time budget
+ * @return              -EOVERFLOW, if there are too many threads running already
+ */
+kernel_pid_t thread_create_ext(char *stack,
+                               int stacksize,
+                               uint8_t priority,
+                               int flags,
+                               thread_task_func_t task_func,
+                               void *arg,
+                               const char *name,
+                               const thread_attr_t *attr);
 
 /**
  * @brief       Retrieve a thread control block by PID.
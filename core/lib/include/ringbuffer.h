@@ -19,6 +19,12 @@
  * @details The ringbuffer is useful for buffering data in the same
  * thread context but it is not thread-safe.  For a thread-safe ring
  * buffer, see @ref sys_tsrb in the System library.
+ *
+ * Besides copying data in and out, the ringbuffer can hand out its memory
+ * directly: ringbuffer_add_span() returns the contiguous free space to fill
+ * (e.g. by DMA), ringbuffer_get_span() the contiguous data to parse in place.
+ * Both take effect only once ringbuffer_add_commit() or
+ * ringbuffer_get_commit() is called.
  * @}
  */
 
@@ -88,6 +94,27 @@ int ringbuffer_add_one(ringbuffer_t *__restrict rb, char c);
 unsigned ringbuffer_add(ringbuffer_t *__restrict rb, const char *buf,
                         unsigned n);
 
+/**
+ * @brief           Get the contiguous free space at the end of the ringbuffer.
+ * @details         The free space may be split in two by the end of the
+ *                  buffer, call again after ringbuffer_add_commit() to get
+ *                  the second part.
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[out]      data  Start of the free space.
+ * @returns         Number of elements that can be written to @p data.
+ *                  0 if rb is full.
+ */
+unsigned ringbuffer_add_span(ringbuffer_t *__restrict rb, char **data);
+
+/**
+ * @brief           Add elements written to the span returned by
+ *                  ringbuffer_add_span() to the ringbuffer.
+ * @pre             @p n is not larger than the span.
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[in]       n     Number of elements written.
+ */
+void ringbuffer_add_commit(ringbuffer_t *__restrict rb, unsigned n);
+
 /**
  * @brief           Peek and remove oldest element from the ringbuffer.
  * @param[in,out]   rb   Ringbuffer to operate on.
@@ -112,6 +139,33 @@ unsigned ringbuffer_get(ringbuffer_t *__restrict rb, char *buf, unsigned n);
  */
 unsigned ringbuffer_remove(ringbuffer_t *__restrict rb, unsigned n);
 
+/**
+ * @brief           Get the contiguous elements at the start of the
+ *                  ringbuffer, without removing them.
+ * @details         The elements may be split in two by the end of the
+ *                  buffer, call again after ringbuffer_get_commit() to get
+ *                  the second part.
+ * @param[in]       rb    Ringbuffer to operate on.
+ * @param[out]      data  Oldest element.
+ * @returns         Number of elements that can be read from @p data.
+ *                  0 if rb is empty.
+ */
+unsigned ringbuffer_get_span(const ringbuffer_t *__restrict rb,
+                             const char **data);
+
+/**
+ * @brief           Remove elements read from the span returned by
+ *                  ringbuffer_get_span() from the ringbuffer.
+ * @pre             @p n is not larger than the span.
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[in]       n     Number of elements read.
+ */
+static inline void ringbuffer_get_commit(ringbuffer_t *__restrict rb,
+                                         unsigned n)
+{
+    ringbuffer_remove(rb, n);
+}
+
 /**
  * @brief           Test if the ringbuffer is empty.
  * @param[in,out]   rb    Ringbuffer to operate on.
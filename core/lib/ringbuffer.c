@@ -18,6 +18,7 @@
 
 #include "ringbuffer.h"
 
+#include <assert.h>
 #include <string.h>
 
 /**
@@ -56,15 +57,55 @@ static char get_head(ringbuffer_t *restrict rb)
 
 unsigned ringbuffer_add(ringbuffer_t *restrict rb, const char *buf, unsigned n)
 {
-    unsigned i;
-
-    for (i = 0; i < n; i++) {
-        if (ringbuffer_full(rb)) {
-            break;
+    unsigned added = 0;
+    unsigned span;
+    char *data;
+
+    /* at most two spans: up to the end of buf and from its start */
+    while ((added < n) && (span = ringbuffer_add_span(rb, &data))) {
+        if (span > n - added) {
+            span = n - added;
         }
-        add_tail(rb, buf[i]);
+        memcpy(data, buf + added, span);
+        ringbuffer_add_commit(rb, span);
+        added += span;
+    }
+    return added;
+}
+
+unsigned ringbuffer_add_span(ringbuffer_t *restrict rb, char **data)
+{
+    if (rb->avail == 0) {
+        /* make all of the free space contiguous */
+        rb->start = 0;
+    }
+
+    unsigned pos = rb->start + rb->avail;
+    unsigned span;
+
+    if (pos >= rb->size) {
+        pos -= rb->size;
+        span = rb->start - pos;
+    }
+    else {
+        span = rb->size - pos;
     }
-    return i;
+    *data = rb->buf + pos;
+    return span;
+}
+
+void ringbuffer_add_commit(ringbuffer_t *restrict rb, unsigned n)
+{
+    assert(n <= ringbuffer_get_free(rb));
+    rb->avail += n;
+}
+
+unsigned ringbuffer_get_span(const ringbuffer_t *restrict rb, const char **data)
+{
+    unsigned bytes_till_end = rb->size - rb->start;
+
+    *data = rb->buf + rb->start;
+    return (rb->avail < bytes_till_end) ? rb->avail : bytes_till_end;
 }
 
 int ringbuffer_add_one(ringbuffer_t *restrict rb, char c)
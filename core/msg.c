@@ -239,6 +239,87 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     return res;
 }
 
+/* Delivers as many of the messages as the target can take without blocking.
+ * Must be called with interrupts disabled. */
+static unsigned _msg_send_batch_oneway(msg_t *m, unsigned num,
+                                       thread_t *target, kernel_pid_t sender,
+                                       bool *woken)
+{
+    unsigned n = 0;
+
+    *woken = false;
+    if (target->status == STATUS_RECEIVE_BLOCKED) {
+        DEBUG("msg_send_batch(): Direct msg copy to %" PRIkernel_pid ".\n",
+              target->pid);
+        m[0].sender_pid = sender;
+        *(msg_t *)target->wait_data = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        *woken = true;
+        n++;
+    }
+
+    for (; n < num; n++) {
+        m[n].sender_pid = sender;
+        if (!queue_msg(target, &m[n])) {
+            break;
+        }
+    }
+
+    DEBUG("msg_send_batch(): delivered %u of %u messages to %" PRIkernel_pid
+          "\n", n, num, target->pid);
+    return n;
+}
+
+int msg_send_batch(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    const kernel_pid_t sender = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    unsigned sent = 0;
+    bool woken;
+
+    while (sent < num) {
+        unsigned state = irq_disable();
+        thread_t *target = thread_get_unchecked(target_pid);
+
+        if (target == NULL) {
+            DEBUG("msg_send_batch(): target thread %d does not exist\n",
+                  target_pid);
+            irq_restore(state);
+            return sent ? (int)sent : -1;
+        }
+
+        sent += _msg_send_batch_oneway(&m[sent], num - sent, target, sender,
+                                       &woken);
+        if (in_irq) {
+            if (woken) {
+                sched_context_switch_request = 1;
+            }
+            irq_restore(state);
+            break;
+        }
+        if ((sent == num) || (sender == target_pid)) {
+            uint16_t target_prio = target->priority;
+            irq_restore(state);
+            if (woken) {
+                sched_switch(target_prio);
+            }
+            else if (IS_USED(MODULE_CORE_THREAD_FLAGS) &&
+                     sched_context_switch_request) {
+                thread_yield_higher();
+            }
+            break;
+        }
+
+        /* the queue is full, block until the target takes the next one */
+        if (_msg_send(&m[sent], target_pid, true, state) < 0) {
+            break;
+        }
+        sent++;
+    }
+
+    return sent;
+}
+
 int msg_send_bus(msg_t *m, msg_bus_t *bus)
 {
     const bool in_irq = irq_is_in();
@@ -436,6 +517,77 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* Takes up to max messages without blocking, senders blocked on a full queue
+ * move into the slots that got free to keep the order of messages. Must be
+ * called with interrupts disabled. */
+static unsigned _msg_receive_batch(thread_t *me, msg_t *buf, unsigned max,
+                                   uint16_t *wake_prio)
+{
+    unsigned n = 0;
+    int queue_index;
+
+    if (thread_has_msg_queue(me)) {
+        while ((n < max) && ((queue_index = cib_get(&me->msg_queue)) >= 0)) {
+            buf[n++] = me->msg_array[queue_index];
+        }
+    }
+
+    while (me->msg_waiters.next) {
+        msg_t *m;
+
+        if (n < max) {
+            m = &buf[n++];
+        }
+        else if (thread_has_msg_queue(me) &&
+                 ((queue_index = cib_put(&me->msg_queue)) >= 0)) {
+            m = &me->msg_array[queue_index];
+        }
+        else {
+            break;
+        }
+
+        thread_t *sender = container_of((clist_node_t *)
+                                        list_remove_head(&me->msg_waiters),
+                                        thread_t, rq_entry);
+        *m = *(msg_t *)sender->wait_data;
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < *wake_prio) {
+                *wake_prio = sender->priority;
+            }
+        }
+    }
+
+    return n;
+}
+
+int msg_receive_batch(msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    uint16_t wake_prio = THREAD_PRIORITY_IDLE;
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    unsigned n = _msg_receive_batch(me, buf, max, &wake_prio);
+
+    if (n == 0) {
+        irq_restore(state);
+        /* nothing there yet, block for the first message */
+        _msg_receive(buf, 1);
+        state = irq_disable();
+        n = 1 + _msg_receive_batch(me, &buf[1], max - 1, &wake_prio);
+    }
+    irq_restore(state);
+
+    DEBUG("msg_receive_batch: %" PRIkernel_pid ": got %u messages\n",
+          me->pid, n);
+    if (wake_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(wake_prio);
+    }
+    return n;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
@@ -35,6 +35,116 @@
 
 #if MAXTHREADS > 1
 
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+/* mutex each thread is blocked on, used to follow chains of owners */
+static mutex_t *_blocked_on[KERNEL_PID_LAST + 1];
+/* priority of each thread before it got boosted plus one, 0 if not boosted */
+static uint8_t _base_priority[KERNEL_PID_LAST + 1];
+
+/**
+ * @brief   Change the priority of @p thread, keeping the wait queue of the
+ *          mutex it may be blocked on sorted
+ * @pre     IRQs are disabled
+ */
+static void _set_priority(thread_t *thread, uint8_t priority)
+{
+    mutex_t *mutex = (thread->status == STATUS_MUTEX_BLOCKED)
+                   ? _blocked_on[thread->pid] : NULL;
+
+    if (mutex) {
+        list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+        sched_change_priority(thread, priority);
+        thread_add_to_list(&mutex->queue, thread);
+    }
+    else {
+        sched_change_priority(thread, priority);
+    }
+}
+
+/**
+ * @brief   Boost the owner of @p mutex and, if it is blocked on another
+ *          mutex itself, the owners along the chain to @p priority
+ * @pre     IRQs are disabled
+ */
+static void _inherit_priority(mutex_t *mutex, uint8_t priority)
+{
+    /* a thread waits for one mutex at most, so a deadlock forms a cycle of at
+     * most MAXTHREADS owners */
+    for (unsigned i = 0; mutex && (i < MAXTHREADS); i++) {
+        thread_t *owner = thread_get(mutex->owner);
+        if (!owner || (owner->priority <= priority)) {
+            return;
+        }
+
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
+              ": %u --> %u\n",
+              thread_getpid(), owner->pid,
+              (unsigned)owner->priority, (unsigned)priority);
+
+        if (!_base_priority[owner->pid]) {
+            _base_priority[owner->pid] = owner->priority + 1;
+        }
+        mutex = (owner->status == STATUS_MUTEX_BLOCKED)
+              ? _blocked_on[owner->pid] : NULL;
+        _set_priority(owner, priority);
+    }
+}
+
+/**
+ * @brief   Drop the boost of thread @p pid to what the threads still waiting
+ *          for mutexes it holds require
+ * @pre     IRQs are disabled
+ *
+ * Threads that were never boosted are left alone in constant time, otherwise
+ * all threads are checked for the mutex they are waiting for.
+ */
+static void _restore_priority(kernel_pid_t pid)
+{
+    thread_t *owner = thread_get(pid);
+
+    if (!owner || !_base_priority[pid]) {
+        return;
+    }
+
+    uint8_t priority = _base_priority[pid] - 1;
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *waiter = thread_get_unchecked(i);
+        if (waiter && (waiter->status == STATUS_MUTEX_BLOCKED) &&
+            _blocked_on[i] && (_blocked_on[i]->owner == pid) &&
+            (waiter->priority < priority)) {
+            priority = waiter->priority;
+        }
+    }
+
+    if (priority == _base_priority[pid] - 1) {
+        _base_priority[pid] = 0;
+    }
+    if (owner->priority != priority) {
+        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
+              owner->pid, (unsigned)owner->priority, (unsigned)priority);
+        _set_priority(owner, priority);
+    }
+}
+#endif
+
+/**
+ * @brief   Pass a locked mutex on to the waiter @p next that was just woken up
+ * @pre     IRQs are disabled
+ */
+static inline void _pass_on(mutex_t *mutex, thread_t *next)
+{
+    (void)mutex;
+    (void)next;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    kernel_pid_t prev = mutex->owner;
+    /* the remaining waiters now wait for next */
+    mutex->owner = next->pid;
+    _restore_priority(prev);
+#elif IS_USED(MODULE_CORE_MUTEX_DEBUG)
+    mutex->owner = next->pid;
+#endif
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -75,20 +185,17 @@ void _block(mutex_t *mutex,
         thread_add_to_list(&mutex->queue, me);
     }
 
-#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    _blocked_on[me->pid] = mutex;
+    _inherit_priority(mutex, me->priority);
 #endif
 
     irq_restore(irq_state);
     thread_yield_higher();
     /* We were woken up by scheduler. Waker removed us from queue. */
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+    _blocked_on[me->pid] = NULL;
+#endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = pc;
 #endif
@@ -115,9 +222,6 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
         mutex->owner_calling_pc = pc;
-#endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
@@ -134,6 +238,38 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
     return true;
 }
 
+void mutex_lock_adaptive(mutex_t *mutex, mutex_spin_t *spin)
+{
+    if (mutex_trylock(mutex)) {
+        return;
+    }
+
+    uint32_t budget = CONFIG_MUTEX_SPIN_MIN + (spin->avg >> 3);
+    if (budget > CONFIG_MUTEX_SPIN_MAX) {
+        budget = CONFIG_MUTEX_SPIN_MAX;
+    }
+
+    uint32_t polls;
+    for (polls = 1; polls <= budget; polls++) {
+        if (mutex_trylock(mutex)) {
+            spin->avg += ((int32_t)(polls << 4) - (int32_t)spin->avg) / 8;
+            spin->spun++;
+            return;
+        }
+        if (mutex->queue.next != MUTEX_LOCKED) {
+            /* there are waiters, they will get the mutex first */
+            break;
+        }
+    }
+
+    DEBUG("PID[%" PRIkernel_pid "] mutex_lock_adaptive(): blocking after %"
+          PRIu32 " polls\n", thread_getpid(), polls);
+    /* the mutex was held for at least as long as we polled */
+    spin->avg += ((int32_t)(polls << 4) - (int32_t)spin->avg) / 8;
+    spin->blocked++;
+    mutex_lock(mutex);
+}
+
 int mutex_lock_cancelable(mutex_cancel_t *mc)
 {
     uinttxtptr_t pc = 0;
@@ -164,9 +300,6 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
 #endif
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
         mutex->owner_calling_pc = pc;
-#endif
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-        mutex->owner_original_priority = me->priority;
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
@@ -198,7 +331,11 @@ void mutex_unlock(mutex_t *mutex)
 
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
-        /* the mutex was locked and no thread was waiting for it */
+        /* the mutex was locked and no thread was waiting for it, a waiter
+         * that cancelled may still have boosted the owner */
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+        _restore_priority(mutex->owner);
+#endif
         irq_restore(irqstate);
         return;
     }
@@ -217,15 +354,7 @@ void mutex_unlock(mutex_t *mutex)
 
     uint16_t process_priority = process->priority;
 
-#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid,
-              (unsigned)owner->priority, (unsigned)owner->priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
-#endif
+    _pass_on(mutex, process);
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = 0;
 #endif
@@ -243,6 +372,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+#if IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE)
+            _restore_priority(mutex->owner);
+#endif
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -254,6 +386,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+            _pass_on(mutex, process);
         }
     }
 
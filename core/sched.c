@@ -36,6 +36,14 @@
 #include "mpu.h"
 #endif
 
+#if IS_USED(MODULE_SCHED_EDF)
+#include "sched_edf.h"
+#endif
+
+#if IS_USED(MODULE_SCHED_BUDGET)
+#include "sched_budget.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -76,7 +84,13 @@ const uint8_t _tcb_name_offset = offsetof(thread_t, name);											// Salva l'
 volatile thread_t *sched_active_thread;															// Definisce un puntatore al thread attivo
 volatile unsigned int sched_context_switch_request;													// Segnala una richiesta di cambio di contesto
 
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+sched_runq_t sched_runqueues[SCHED_PRIO_LEVELS];
+static_assert(KERNEL_PID_LAST <= UINT8_MAX,
+              "sched_runq_array stores pids in uint8_t");
+#else
 clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];												// Definisce un array di liste, le quali sono code di esecuzione
+#endif
 static uint32_t runqueue_bitcache = 0;																// Definisce una cache per memorizzare lo stato delle code di esecuzione. Se il bit 0 è impostato su 1, indica che c'è almeno un thread nella coda di priorità 0,
 																							// se il bit 1 è impostato su 1, indica che c'è almeno un thread nella coda di priorità 1, e così via.
 
@@ -149,15 +163,72 @@ static void _unschedule(thread_t *active_thread)													// Mette un thread
 }																							// Se è presente il modulo di callback dello scheduler e la variabile sched_cb è stata definita, viene chiamata la funzione di callback con i 
 																							// parametri active_thread->pid e KERNEL_PID_UNDEF
 
+static inline thread_t *_runq_head(uint8_t prio)
+{
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    const sched_runq_t *runq = &sched_runqueues[prio];
+    return (thread_t *)sched_threads[runq->pids[runq->head]];
+#else
+    return container_of(sched_runqueues[prio].next->next, thread_t, rq_entry);
+#endif
+}
+
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+/* returns the position of the pid relative to the head of the runqueue */
+static unsigned _runq_find(const sched_runq_t *runq, kernel_pid_t pid)
+{
+    unsigned pos = 0;
+
+    while (runq->pids[_sched_runq_slot(runq->head + pos)] != pid) {
+        pos++;
+        assert(pos < runq->count);
+    }
+    return pos;
+}
+#endif
+
+thread_t *sched_runq_head(uint8_t prio)
+{
+    assert(!sched_runq_is_empty(prio));
+    return _runq_head(prio);
+}
+
+void sched_runq_move_to_front(thread_t *thread)
+{
+    if (_runq_head(thread->priority) == thread) {
+        return;
+    }
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    sched_runq_t *runq = &sched_runqueues[thread->priority];
+
+    /* shift the threads in front of it back by one */
+    for (unsigned pos = _runq_find(runq, thread->pid); pos; pos--) {
+        runq->pids[_sched_runq_slot(runq->head + pos)] =
+            runq->pids[_sched_runq_slot(runq->head + pos - 1)];
+    }
+    runq->pids[runq->head] = thread->pid;
+#else
+    clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+    clist_lpush(&sched_runqueues[thread->priority], &thread->rq_entry);
+#endif
+}
+
 thread_t *__attribute__((used)) sched_run(void)														// Questa funzione serve per gestire il cambio di contesto tra thread
 {
     thread_t *active_thread = thread_get_active();														// La funzione prende il PID del thread attivo e lo immagazzina in una variabile
     thread_t *previous_thread = active_thread;														// Crea una variabile di "copia" del thread attivo
 
+#if IS_USED(MODULE_SCHED_FEEDBACK)
+    sched_feedback_account(active_thread);
+#endif
+
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache) {								// Se il modulo di idle thread non è utilizzato ed il bit di runqueue è vuoto
         if (active_thread) {																			// Viene deschedulato il thread se esistente
             _unschedule(active_thread);
             active_thread = NULL;
+#if IS_USED(MODULE_SCHED_BUDGET)
+            sched_budget_switch(NULL);
+#endif
         }
 
         do {
@@ -168,8 +239,7 @@ thread_t *__attribute__((used)) sched_run(void)														// Questa funzione
     sched_context_switch_request = 0;																// A questo punto viene azzerata la richiesta di context switch
 
     unsigned nextrq = _get_prio_queue_from_runqueue();												// Restituisce la prossima coda
-    thread_t *next_thread = container_of(sched_runqueues[nextrq].next->next,
-                                         thread_t, rq_entry);														// Viene ottenuto il PID del prossimo thread
+    thread_t *next_thread = _runq_head(nextrq);														// Viene ottenuto il PID del prossimo thread
 
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK))
     sched_runq_callback(nextrq);																	// Viene chiamata la funzione di callback se esiste il modulo
@@ -195,14 +265,31 @@ thread_t *__attribute__((used)) sched_run(void)														// Questa funzione
         if (sched_cb && !active_thread) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);												// Se il thread attivo è NULL, viene chiamata la callback sched_cb con l'ID del prossimo thread.
         }
+#endif
+#if IS_USED(MODULE_SCHED_TRACE)
+        if (!active_thread) {
+            sched_trace_switch(NULL, next_thread);
+        }
+#endif
+#if IS_USED(MODULE_SCHED_BUDGET)
+        if (!active_thread) {
+            sched_budget_switch(next_thread);
+        }
 #endif
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");								// Viene stampato un messaggio di debug.
     }
     else {																						// Se i due thread sono diversi
+#if IS_USED(MODULE_SCHED_TRACE)
+        sched_trace_switch(active_thread, next_thread);
+#endif
         if (active_thread) {
             _unschedule(active_thread);																// Il thread attivo (se esiste) viene deschedulato
         }
 
+#if IS_USED(MODULE_SCHED_BUDGET)
+        sched_budget_switch(next_thread);
+#endif
+
         sched_active_pid = next_thread->pid;															// Viene impostato il PID del prossimo thread
         sched_active_thread = next_thread;															// Viene impostato il prossimo thread
 
@@ -236,7 +323,20 @@ static inline __attribute__((always_inline)) void _runqueue_push(thread_t *threa
 {
     DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu8 ".\n",
           thread->pid, priority);																		// Indica l'inserimento del thread nella coda
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    sched_runq_t *runq = &sched_runqueues[priority];
+    runq->pids[_sched_runq_slot(runq->head + runq->count)] = thread->pid;
+    runq->count++;
+#else
+#if IS_USED(MODULE_SCHED_EDF)
+    if (priority == SCHED_EDF_PRIO) {
+        /* the EDF runqueue is kept in deadline order */
+        sched_edf_runq_push(&sched_runqueues[priority], thread);
+    }
+    else
+#endif
     clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));										// Inserisce il puntatore all'elemento rq_entry del thread nella runqueue corrispondente alla priorità.
+#endif
     _set_runqueue_bit(priority);																	// Imposta il bit corrispondente alla priorità nella variabile runqueue_bitcache.
 
     /* some thread entered a runqueue
@@ -248,6 +348,9 @@ static inline __attribute__((always_inline)) void _runqueue_push(thread_t *threa
         sched_runq_callback(priority);																// Allora viene chiamata la funzione di callback
     }
 #endif
+#if IS_USED(MODULE_SCHED_FEEDBACK)
+    sched_feedback_runq_push(thread, priority);
+#endif
 }
 
 /* Note: Forcing the compiler to inline this function will reduce .text for applications
@@ -257,9 +360,33 @@ static inline __attribute__((always_inline)) void _runqueue_pop(thread_t *thread
 {
     DEBUG("sched_set_status: removing thread %" PRIkernel_pid " from runqueue %" PRIu8 ".\n",
           thread->pid, thread->priority);																// Indica la rimozione del thread dalla coda
+#if IS_USED(MODULE_SCHED_RUNQ_ARRAY)
+    sched_runq_t *runq = &sched_runqueues[thread->priority];
+    if (runq->pids[runq->head] == thread->pid) {
+        runq->head = _sched_runq_slot(runq->head + 1);
+    }
+    else {
+        /* close the gap, keeping the order of the threads behind it */
+        for (unsigned pos = _runq_find(runq, thread->pid);
+             pos < runq->count - 1u; pos++) {
+            runq->pids[_sched_runq_slot(runq->head + pos)] =
+                runq->pids[_sched_runq_slot(runq->head + pos + 1)];
+        }
+    }
+    runq->count--;
+#else
+#if IS_USED(MODULE_SCHED_EDF)
+    if (thread->priority == SCHED_EDF_PRIO) {
+        /* a thread with an earlier deadline may have been queued in front of
+         * the running one */
+        clist_remove(&sched_runqueues[thread->priority], &(thread->rq_entry));
+    }
+    else
+#endif
     clist_lpop(&sched_runqueues[thread->priority]);													// Rimuove il thread dalla coda
+#endif
 
-    if (!sched_runqueues[thread->priority].next) {														// Se la runqueue è vuota viene chiamata la funzione di callback
+    if (sched_runq_is_empty(thread->priority)) {														// Se la runqueue è vuota viene chiamata la funzione di callback
         _clear_runqueue_bit(thread->priority);
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK))
         sched_runq_callback(thread->priority);
@@ -294,6 +421,16 @@ void sched_switch(uint16_t other_prio)															// Funzione che gestisce i
           active_thread->pid, current_prio, on_runqueue,
           other_prio);
 
+#if IS_USED(MODULE_SCHED_EDF)
+    /* within the EDF priority, a thread with an earlier deadline got queued
+     * in front of the active one */
+    if (on_runqueue && (current_prio == other_prio) &&
+        (current_prio == SCHED_EDF_PRIO) &&
+        (sched_runqueues[current_prio].next->next != &active_thread->rq_entry)) {
+        on_runqueue = 0;
+    }
+#endif
+
     if (!on_runqueue || (current_prio > other_prio)) {													// Viene verificato se il thread attivo non è nella runqueue (!on_runqueue) o se ha una priorità maggiore dell'altro thread (current_prio > other_prio).
         if (irq_is_in()) {																			// Se uno di questi due casi è vero, viene verificato se la funzione è stata chiamata all'interno di un'interfaccia di interrupt
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
@@ -326,6 +463,13 @@ NORETURN void sched_task_exit(void)															// Termina il thread corrente
 
     sched_set_status(thread_get_active(), STATUS_STOPPED);											// Imposta lo stato del thread corrente a STATUS_STOPPED chiamando la funzione sched_set_status. Questo indica che il thread è stato fermato.
 
+#if IS_USED(MODULE_SCHED_EDF)
+    sched_edf_thread_exit(thread_getpid());
+#endif
+#if IS_USED(MODULE_SCHED_BUDGET)
+    sched_budget_thread_exit(thread_getpid());
+#endif
+
     sched_active_thread = NULL;																	// Imposta il puntatore sched_active_thread a NULL per indicare che non c'è alcun thread attivo.
     cpu_switch_context_exit();																	// Chiama la funzione cpu_switch_context_exit() per gestire la terminazione del contesto del thread e passare ad un altro thread o alla logica di spegnimento del 
 																							// sistema operativo, a seconda dell'implementazione specifica.
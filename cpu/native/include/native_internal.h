@@ -112,6 +112,8 @@ extern int (*real_accept)(int socket, ...);
 extern int (*real_bind)(int socket, ...);
 extern int (*real_connect)(int socket, ...);
 extern int (*real_recv)(int sockfd, void *buf, size_t len, int flags);
+/* void * instead of struct msghdr * to save includes: */
+extern ssize_t (*real_recvmsg)(int sockfd, void *msg, int flags);
 extern int (*real_chdir)(const char *path);
 extern int (*real_close)(int);
 extern int (*real_fcntl)(int, int, ...);
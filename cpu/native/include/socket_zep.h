@@ -85,10 +85,6 @@ typedef struct {
     const socket_zep_params_t *params;
     int sock_fd;                    /**< socket fd */
     uint32_t seq;                   /**< ZEP sequence number */
-    /**
-     * @brief   Receive buffer
-     */
-    uint8_t rcv_buf[sizeof(zep_v2_data_hdr_t) + IEEE802154_FRAME_LEN_MAX];
     /**
      * @brief   Send buffer
      */
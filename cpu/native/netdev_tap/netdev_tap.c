@@ -135,6 +135,11 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
                 res = sizeof(bool);
             }
             break;
+        case NETOPT_RX_ONE_PASS:
+            /* _recv() reads the frame straight into the given buffer */
+            *((netopt_enable_t *)value) = NETOPT_ENABLE;
+            res = sizeof(netopt_enable_t);
+            break;
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
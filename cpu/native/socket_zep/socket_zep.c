@@ -24,6 +24,7 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 
 #include "async_read.h"
 #include "byteorder.h"
@@ -489,71 +490,80 @@ static int _read(ieee802154_dev_t *dev, void *buf, size_t max_size,
 {
     int res;
     socket_zep_t *zepdev = dev->priv;
-    size_t frame_len = max_size + sizeof(zep_v2_data_hdr_t) + 2;
+    zep_v2_data_hdr_t zep;
+    uint8_t fcs[2];
+    size_t frame_len = sizeof(zep) + max_size + sizeof(fcs);
+    /* scatter the datagram, so the PSDU lands in @p buf without a copy.
+     * If the frame is shorter than @p max_size, the FCS ends up in @p buf
+     * behind the PSDU. */
+    struct iovec iov[] = {
+        { .iov_base = &zep, .iov_len = sizeof(zep) },
+        { .iov_base = buf, .iov_len = buf ? max_size : 0 },
+        { .iov_base = fcs, .iov_len = sizeof(fcs) },
+    };
+    struct msghdr msg = {
+        .msg_iov = iov,
+        .msg_iovlen = sizeof(iov) / sizeof(iov[0]),
+    };
 
     DEBUG("socket_zep::read: reading up to %u bytes into %p\n", max_size, buf);
 
-    if (frame_len > sizeof(zepdev->rcv_buf)) {
-        DEBUG("socket_zep::read: frame size (%zu) exceeds RX  buffer (%zu bytes)\n",
-              frame_len, sizeof(zepdev->rcv_buf));
-        res = -ENOBUFS;
-        goto out;
-    }
-
-    res = real_recv(zepdev->sock_fd, zepdev->rcv_buf, frame_len, MSG_TRUNC);
+    res = real_recvmsg(zepdev->sock_fd, &msg, MSG_TRUNC);
 
     DEBUG("socket_zep::read: got %d/%zu bytes\n", res, frame_len);
 
-    if (res <= (int)sizeof(zep_v2_data_hdr_t) || res > (int)frame_len) {
-        DEBUG("socket_zep::read: %s\n", strerror(errno));
+    if (buf == NULL) {
+        /* frame dropped */
         res = 0;
         goto out;
     }
 
-    zep_hdr_t *tmp = (zep_hdr_t *)zepdev->rcv_buf;
+    if (res < (int)(sizeof(zep) + sizeof(fcs)) || res > (int)frame_len) {
+        DEBUG("socket_zep::read: %s\n", strerror(errno));
+        res = 0;
+        goto out;
+    }
 
-    if ((tmp->preamble[0] != 'E') || (tmp->preamble[1] != 'X')) {
+    if ((zep.hdr.preamble[0] != 'E') || (zep.hdr.preamble[1] != 'X')) {
         DEBUG("socket_zep::read: invalid ZEP header\n");
         res = -EINVAL;
         goto out;
     }
 
-    if (tmp->version != 2) {
-        DEBUG("socket_zep::read: unsupported ZEP version %u\n", tmp->version);
+    if (zep.hdr.version != 2) {
+        DEBUG("socket_zep::read: unsupported ZEP version %u\n", zep.hdr.version);
         res = -EINVAL;
         goto out;
     }
 
-    switch (((zep_v2_ack_hdr_t *)tmp)->type) {
+    switch (zep.type) {
     case ZEP_V2_TYPE_DATA: {
-        zep_v2_data_hdr_t *zep = (zep_v2_data_hdr_t *)tmp;
-
-        if (zep->chan != zepdev->chan) {
+        if (zep.chan != zepdev->chan) {
             DEBUG("socket_zep::read: wrong channel\n");
             res = -EINVAL;
             break;
         }
 
         if (info) {
-            info->lqi = zep->lqi_val;
+            info->lqi = zep.lqi_val;
             info->rssi = -IEEE802154_RADIO_RSSI_OFFSET;
         }
 
-        if (_dst_not_me(zepdev, zep + 1)) {
+        if (_dst_not_me(zepdev, buf)) {
             DEBUG("socket_zep::read: dst not me\n");
             res = -EINVAL;
             break;
         }
 
-        _send_ack(zepdev, zep + 1);
+        _send_ack(zepdev, buf);
 
-        memcpy(buf, zep + 1, max_size);
-        res = max_size;
+        /* report size without ZEP header and checksum */
+        res -= sizeof(zep) + sizeof(fcs);
 
         break;
     }
     default:
-        DEBUG("socket_zep::read: unknown type %u\n", ((zep_v2_ack_hdr_t *)tmp)->type);
+        DEBUG("socket_zep::read: unknown type %u\n", zep.type);
         res = -EINVAL;
         break;
     }
@@ -616,7 +626,8 @@ static const ieee802154_radio_ops_t socket_zep_rf_ops = {
           | IEEE802154_CAP_AUTO_CSMA
           | IEEE802154_CAP_IRQ_TX_DONE
           | IEEE802154_CAP_IRQ_TX_START
-          | IEEE802154_CAP_PHY_OQPSK,
+          | IEEE802154_CAP_PHY_OQPSK
+          | IEEE802154_CAP_RX_ONE_PASS,
 
     .write = _write,
     .read = _read,
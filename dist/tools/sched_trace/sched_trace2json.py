@@ -0,0 +1,142 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to convert a trace recorded by the `sched_trace` module into the Chrome
+trace event JSON format, which can be opened with https://ui.perfetto.dev or
+chrome://tracing.
+
+The trace is either the binary file written by `schedtrace dump <file>` on the
+native board, or a terminal log containing the hex encoded output of
+`schedtrace dump`.
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = 0x52545352
+VERSION = 1
+HDR_FMT = "IBBHII"
+REC_FMT = "IhhBB"
+
+# thread_status_t, see core/include/sched.h
+STATUS = [
+    "stopped",
+    "zombie",
+    "sleeping",
+    "mutex blocked",
+    "receive blocked",
+    "send blocked",
+    "reply blocked",
+    "flag blocked any",
+    "flag blocked all",
+    "mbox blocked",
+    "cond blocked",
+    "preempted",
+    "pending",
+]
+REASON_IDLE = 0xff
+
+
+def from_log(text):
+    """Extract the hex encoded trace from a terminal log"""
+    match = re.search(r"--- sched_trace begin ---(.*?)--- sched_trace end ---",
+                      text, re.S)
+    if not match:
+        sys.exit("no trace found in the log")
+    # strip prompts and timestamps terminal programs may add to each line
+    data = "".join(re.findall(r"([0-9a-f]+)\s*$", match.group(1), re.M))
+    return bytes.fromhex(data)
+
+
+def parse(data):
+    """Parse a binary trace into thread names, lost count and records"""
+    for endian in "<>":
+        if struct.unpack_from(endian + "I", data)[0] == MAGIC:
+            break
+    else:
+        sys.exit("not a sched_trace dump")
+
+    hdr = endian + HDR_FMT
+    _, version, rec_size, names, tps, lost = struct.unpack_from(hdr, data)
+    if version != VERSION or rec_size != struct.calcsize(endian + REC_FMT):
+        sys.exit("unsupported trace version {} (record size {})"
+                 .format(version, rec_size))
+    pos = struct.calcsize(hdr)
+
+    threads = {}
+    for _ in range(names):
+        pid, length = struct.unpack_from(endian + "hB", data, pos)
+        pos += 3
+        threads[pid] = data[pos:pos + length].decode(errors="replace")
+        pos += length
+
+    records = []
+    wraps = 0
+    last = None
+    # ignore a truncated last record
+    end = len(data) - (len(data) - pos) % rec_size
+    for time, prev, nxt, reason, level in \
+            struct.iter_unpack(endian + REC_FMT, data[pos:end]):
+        if last is not None and time < last:
+            wraps += 1
+        last = time
+        usec = (time + (wraps << 32)) * 1000000 / tps
+        records.append((usec, prev, nxt, reason, level))
+    return threads, lost, records
+
+
+def convert(threads, lost, records):
+    """Build the Chrome trace events of the parsed trace"""
+    events = []
+    pids = {r[2] for r in records} | set(threads)
+    for pid in sorted(pids):
+        name = threads.get(pid) or "pid {}".format(pid)
+        events.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": pid,
+                       "args": {"name": "{} ({})".format(name, pid)}})
+
+    # every record starts the slice of its next thread, the following one ends
+    # it and tells why the thread left the CPU
+    for cur, nxt in zip(records, records[1:]):
+        reason = nxt[3]
+        if reason == REASON_IDLE:
+            reason = "idle"
+        elif reason < len(STATUS):
+            reason = STATUS[reason]
+        events.append({"ph": "X", "name": threads.get(cur[2]) or str(cur[2]),
+                       "cat": "sched", "pid": 0, "tid": cur[2],
+                       "ts": cur[0], "dur": nxt[0] - cur[0],
+                       "args": {"level": cur[4], "switched out": reason}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ns",
+            "otherData": {"lost records": lost}}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("trace", type=argparse.FileType("rb"),
+                        help="binary trace or terminal log of `schedtrace dump`")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout, help="JSON file to write")
+    args = parser.parse_args()
+
+    data = args.trace.read()
+    if data[:4] not in (struct.pack("<I", MAGIC), struct.pack(">I", MAGIC)):
+        data = from_log(data.decode(errors="replace"))
+
+    threads, lost, records = parse(data)
+    if lost:
+        print("{} records were lost".format(lost), file=sys.stderr)
+    json.dump(convert(threads, lost, records), args.output, indent=1)
+
+
+if __name__ == "__main__":
+    main()
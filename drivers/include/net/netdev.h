@@ -503,6 +503,11 @@ typedef struct netdev_driver {
      *    to implement the dropping - or may not change it.)
      *  - `-ENOBUFS` is returned
      *
+     * Drivers that report @ref NETOPT_RX_ONE_PASS can be called with a
+     * buffer of the maximum frame size right away, so the frame is received
+     * with a single call into memory provided by the upper layer, e.g. the
+     * packet buffer.
+     *
      * @param[in]   dev     network device descriptor. Must not be NULL.
      * @param[out]  buf     buffer to write into or NULL to return the frame
      *                      size.
@@ -59,6 +59,12 @@ static int _get(netdev_t *netdev, netopt_t opt, void *value, size_t max_len)
         case NETOPT_IEEE802154_PHY:
             *((uint8_t*) value) = ieee802154_get_phy_mode(submac);
             return 1;
+        case NETOPT_RX_ONE_PASS:
+            if (!ieee802154_radio_has_rx_one_pass(&submac->dev)) {
+                return -ENOTSUP;
+            }
+            *((netopt_enable_t*) value) = NETOPT_ENABLE;
+            return sizeof(netopt_enable_t);
         default:
             break;
     }
@@ -209,6 +209,57 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     return bytes;
 }
 
+static void _drop(slipdev_t *dev, size_t len)
+{
+    const uint8_t *data;
+    unsigned n;
+
+    while (len && (n = tsrb_get_span(&dev->inbuf, &data))) {
+        if (n > len) {
+            n = len;
+        }
+        const uint8_t *end = memchr(data, SLIPDEV_END, n);
+        if (end) {
+            /* end early if end of packet is reached; len might be larger than
+             * the actual packet */
+            tsrb_get_commit(&dev->inbuf, end - data + 1);
+            return;
+        }
+        tsrb_get_commit(&dev->inbuf, n);
+        len -= n;
+    }
+}
+
+static int _recv_frame(slipdev_t *dev, uint8_t *buf, size_t len)
+{
+    const uint8_t *data;
+    unsigned n;
+    size_t res = 0;
+    bool escaped = false;
+    bool overflow = false;
+
+    /* unstuff the frame directly from the ringbuffer memory */
+    while ((n = tsrb_get_span(&dev->inbuf, &data))) {
+        for (unsigned i = 0; i < n; i++) {
+            if (res >= len) {
+                /* frame is larger than expected - lost end marker, clear out
+                 * unreceived packet */
+                overflow = true;
+            }
+            else {
+                res += slipdev_unstuff_readbyte(&buf[res], data[i], &escaped);
+            }
+            if (data[i] == SLIPDEV_END) {
+                tsrb_get_commit(&dev->inbuf, i + 1);
+                return overflow ? -ENOBUFS : (int)res;
+            }
+        }
+        tsrb_get_commit(&dev->inbuf, n);
+    }
+    /* something went wrong, return error */
+    return -EIO;
+}
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     slipdev_t *dev = (slipdev_t *)netdev;
@@ -218,45 +269,17 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     if (buf == NULL) {
         if (len > 0) {
             /* remove data */
-            for (; len > 0; len--) {
-                int byte = tsrb_get_one(&dev->inbuf);
-                if ((byte == (int)SLIPDEV_END) || (byte < 0)) {
-                    /* end early if end of packet or ringbuffer is reached;
-                     * len might be larger than the actual packet */
-                    break;
-                }
-            }
+            _drop(dev, len);
         } else {
             /* the user was warned not to use a buffer size > `INT_MAX` ;-) */
             res = (int)tsrb_avail(&dev->inbuf);
         }
     }
     else {
-        int byte;
-        bool escaped = false;
-        uint8_t *ptr = buf;
-
-        do {
-            int tmp;
-
-            if ((byte = tsrb_get_one(&dev->inbuf)) < 0) {
-                /* something went wrong, return error */
-                return -EIO;
-            }
-
-            /* frame is larger than expected - lost end marker */
-            if ((unsigned)res >= len) {
-                while (byte != SLIPDEV_END) {
-                    /* clear out unreceived packet */
-                    byte = tsrb_get_one(&dev->inbuf);
-                }
-                return -ENOBUFS;
-            }
-
-            tmp = slipdev_unstuff_readbyte(ptr, byte, &escaped);
-            ptr += tmp;
-            res += tmp;
-        } while (byte != SLIPDEV_END);
+        res = _recv_frame(dev, buf, len);
+        if (res < 0) {
+            return res;
+        }
 
         if (++dev->rx_done != dev->rx_queued) {
             DEBUG("slipdev: pkt still in queue");
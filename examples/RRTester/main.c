@@ -211,36 +211,51 @@ int main(void)
     {
         static char stack[WORKER_STACKSIZE];
         static struct worker_config wc = THREAD_1;   /* 0-10 workness */
-	short int PIDTA = thread_create_feedback(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
-                      thread_worker, &wc, "TA", S_TIME1);
+        static const thread_attr_t attr = {
+            .policy = THREAD_SCHED_FEEDBACK, .level = 1, .service_time = S_TIME1
+        };
+	short int PIDTA = thread_create_ext(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
+                      thread_worker, &wc, "TA", &attr);
 	TA = thread_get(PIDTA);
     }
     {
         static char stack[WORKER_STACKSIZE];
         static struct worker_config wc = THREAD_2;   /* 0-10 workness */
-        short int PIDTB = thread_create_feedback(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
-                      thread_worker, &wc, "TB", S_TIME2);
+        static const thread_attr_t attr = {
+            .policy = THREAD_SCHED_FEEDBACK, .level = 1, .service_time = S_TIME2
+        };
+        short int PIDTB = thread_create_ext(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
+                      thread_worker, &wc, "TB", &attr);
 	TB = thread_get(PIDTB);
     }
     {
         static char stack[WORKER_STACKSIZE];
         static struct worker_config wc = THREAD_3;   /* 0-10 workness */
-        short int PIDTC = thread_create_feedback(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
-                      thread_worker, &wc, "TC", S_TIME3);
+        static const thread_attr_t attr = {
+            .policy = THREAD_SCHED_FEEDBACK, .level = 1, .service_time = S_TIME3
+        };
+        short int PIDTC = thread_create_ext(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
+                      thread_worker, &wc, "TC", &attr);
 	TC = thread_get(PIDTC);
     }
     {
         static char stack[WORKER_STACKSIZE];
         static struct worker_config wc = THREAD_4;   /* 0-10 workness */
-        short int PIDTD = thread_create_feedback(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
-                      thread_worker, &wc, "TD", S_TIME4);
+        static const thread_attr_t attr = {
+            .policy = THREAD_SCHED_FEEDBACK, .level = 1, .service_time = S_TIME4
+        };
+        short int PIDTD = thread_create_ext(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
+                      thread_worker, &wc, "TD", &attr);
 	TD = thread_get(PIDTD);
     }
     {
         static char stack[WORKER_STACKSIZE];
         static struct worker_config wc = THREAD_5;   /* 0-10 workness */
-        short int PIDTE = thread_create_feedback(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
-                      thread_worker, &wc, "TE", S_TIME5);
+        static const thread_attr_t attr = {
+            .policy = THREAD_SCHED_FEEDBACK, .level = 1, .service_time = S_TIME5
+        };
+        short int PIDTE = thread_create_ext(stack, sizeof(stack), 1, THREAD_CREATE_STACKTEST,
+                      thread_worker, &wc, "TE", &attr);
 	TE = thread_get(PIDTE);
     }
 	stampa();
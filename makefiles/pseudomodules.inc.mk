@@ -125,10 +125,13 @@ PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_netdev_default
 ## @}
 PSEUDOMODULES += gnrc_neterr
+PSEUDOMODULES += gnrc_netapi_batch
 PSEUDOMODULES += gnrc_netapi_callbacks
+PSEUDOMODULES += gnrc_netapi_direct
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
+PSEUDOMODULES += gnrc_netreg_hash
 ## @defgroup net_gnrc_pktbuf_cmd  gnrc_pktbuf_cmd
 ## @ingroup net_gnrc_pktbuf
 ## @{
@@ -403,6 +406,18 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+## @defgroup pseudomodule_sched_runq_array sched_runq_array
+## @ingroup core_sched
+## @brief   Keep the runqueues as rings of pids instead of lists
+##
+## Selecting the next thread only reads a compact per-priority array and the
+## thread table instead of following the runqueue list through the thread
+## control blocks. Removing a thread other than the first one of its runqueue
+## costs O(n). Uses `SCHED_PRIO_LEVELS * (MAXTHREADS + 2)` bytes of RAM.
+## Cannot be used with `sched_edf`.
+## @{
+PSEUDOMODULES += sched_runq_array
+## @}
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -480,6 +495,7 @@ PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
 PSEUDOMODULES += shell_cmd_rtt
 PSEUDOMODULES += shell_cmd_saul_reg
+PSEUDOMODULES += shell_cmd_sched_trace
 PSEUDOMODULES += shell_cmd_semtech-loramac
 PSEUDOMODULES += shell_cmd_sha1sum
 PSEUDOMODULES += shell_cmd_sha256sum
@@ -534,6 +550,12 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+## @defgroup pseudomodule_tsrb_spsc tsrb_spsc
+## @brief Access all @ref sys_tsrb ringbuffers without disabling interrupts
+##
+## Only safe if every ringbuffer of the application has at most one producer
+## and one consumer at a time, see @ref sys_tsrb.
+PSEUDOMODULES += tsrb_spsc
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
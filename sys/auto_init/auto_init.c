@@ -71,20 +71,16 @@ AUTO_INIT(sched_round_robin_init,
           AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN);
 #endif
 
-
-/*************************************************************************************************
-* INIZIALIZZAZIONE CREATA APPOSITAMENTE PER LO SCHEDULING FEEDBACK, SI
-* TRATTA DI UNA COPIA DI THREAD_CREATE MA CON L'AGGIUNTA DI UN SERVICE TIME.
-*************************************************************************************************/
 #if IS_USED(MODULE_SCHED_FEEDBACK)
 extern void sched_feedback_init(void);
 AUTO_INIT(sched_feedback_init,
           AUTO_INIT_PRIO_MOD_SCHED_FEEDBACK);
 #endif
-
-/*******************************************************************************************/
-
-
+#if IS_USED(MODULE_SCHED_TRACE)
+extern void sched_trace_init(void);
+AUTO_INIT(sched_trace_init,
+          AUTO_INIT_PRIO_MOD_SCHED_TRACE);
+#endif
 #if IS_USED(MODULE_DUMMY_THREAD)
 extern void dummy_thread_create(void);
 AUTO_INIT(dummy_thread_create,
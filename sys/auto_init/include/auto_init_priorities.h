@@ -65,6 +65,18 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN            1060
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_FEEDBACK
+/**
+ * @brief   feedback scheduling priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_FEEDBACK               1065
+#endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_TRACE
+/**
+ * @brief   scheduler tracing priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_TRACE                  1067
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_DUMMY_THREAD
 /**
  * @brief   dummy thread priority
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_counted
+ * @{
+ *
+ * @file
+ * @brief       Counted event implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "container.h"
+#include "event/counted.h"
+#include "irq.h"
+
+void _event_counted_handler(event_t *event)
+{
+    event_counted_t *event_counted = container_of(event, event_counted_t, super);
+
+    /* the event is already taken from the queue: occurrences counted from
+     * here on queue it again */
+    unsigned state = irq_disable();
+    uint32_t value = event_counted->value;
+    event_counted->value = 0;
+    irq_restore(state);
+
+    /* nothing accumulated if the handler already took the value before the
+     * event was posted again */
+    if (value) {
+        event_counted->handler(event_counted, value);
+    }
+}
+
+void event_counted_init(event_counted_t *event, event_counted_handler_t handler)
+{
+    memset(event, 0, sizeof(*event));
+    event->super.handler = _event_counted_handler;
+    event->handler = handler;
+}
+
+void event_counted_post(event_queue_t *queue, event_counted_t *event)
+{
+    unsigned state = irq_disable();
+    if (event->value < UINT32_MAX) {
+        event->value++;
+    }
+    irq_restore(state);
+
+    event_post(queue, &event->super);
+}
+
+void event_counted_post_mask(event_queue_t *queue, event_counted_t *event,
+                             uint32_t mask)
+{
+    assert(mask);
+
+    unsigned state = irq_disable();
+    event->value |= mask;
+    irq_restore(state);
+
+    event_post(queue, &event->super);
+}
+
+void event_counted_cancel(event_queue_t *queue, event_counted_t *event)
+{
+    unsigned state = irq_disable();
+    event_cancel(queue, &event->super);
+    event->value = 0;
+    irq_restore(state);
+}
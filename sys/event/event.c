@@ -33,6 +33,48 @@
 #include "xtimer.h"
 #endif
 
+#if IS_USED(MODULE_EVENT_STATS)
+#include "event/stats.h"
+
+static void _stats_post(event_queue_t *queue, event_t *event)
+{
+    if (queue->stats) {
+        event_stats_post(queue, event);
+    }
+}
+
+static void _stats_take(event_queue_t *queue, event_t *event)
+{
+    if (queue->stats) {
+        event_stats_take(queue, event);
+    }
+}
+
+static void _stats_cancel(event_queue_t *queue)
+{
+    if (queue->stats) {
+        event_stats_cancel(queue);
+    }
+}
+#else
+static inline void _stats_post(event_queue_t *queue, event_t *event)
+{
+    (void)queue;
+    (void)event;
+}
+
+static inline void _stats_take(event_queue_t *queue, event_t *event)
+{
+    (void)queue;
+    (void)event;
+}
+
+static inline void _stats_cancel(event_queue_t *queue)
+{
+    (void)queue;
+}
+#endif
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
@@ -40,6 +82,7 @@ void event_post(event_queue_t *queue, event_t *event)
     unsigned state = irq_disable();
     if (!event->list_node.next) {
         clist_rpush(&queue->event_list, &event->list_node);
+        _stats_post(queue, event);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -55,7 +98,9 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
+    if (clist_remove(&queue->event_list, &event->list_node)) {
+        _stats_cancel(queue);
+    }
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -64,6 +109,9 @@ event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
     event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    if (result) {
+        _stats_take(queue, result);
+    }
     irq_restore(state);
 
     if (result) {
@@ -84,6 +132,7 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
             result = container_of(clist_lpop(&queues[i].event_list),
                                   event_t, list_node);
             if (result) {
+                _stats_take(&queues[i], result);
                 break;
             }
         }
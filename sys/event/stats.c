@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_stats
+ * @{
+ *
+ * @file
+ * @brief       Event queue statistics implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "clist.h"
+#include "container.h"
+#include "event/stats.h"
+#include "irq.h"
+#include "ztimer.h"
+
+static_assert((CONFIG_EVENT_STATS_LATENCY_BUCKETS >= 2) &&
+              (CONFIG_EVENT_STATS_LATENCY_BUCKETS <= 33),
+              "CONFIG_EVENT_STATS_LATENCY_BUCKETS must be between 2 and 33");
+
+typedef struct {
+    event_queue_stats_t *stats;
+    uint32_t now;
+} _stamp_arg_t;
+
+static int _stamp(clist_node_t *node, void *arg)
+{
+    _stamp_arg_t *stamp = arg;
+
+    container_of(node, event_t, list_node)->enqueued = stamp->now;
+    stamp->stats->posted++;
+    return 0;
+}
+
+void event_queue_stats_attach(event_queue_t *queue, event_queue_stats_t *stats)
+{
+    assert(queue);
+
+    /* the timestamps are taken from ZTIMER_USEC */
+    if (stats) {
+        memset(stats, 0, sizeof(*stats));
+        ztimer_acquire(ZTIMER_USEC);
+    }
+
+    unsigned state = irq_disable();
+    bool was_attached = queue->stats;
+
+    if (stats) {
+        /* events already queued count as posted now */
+        _stamp_arg_t stamp = { .stats = stats, .now = ztimer_now(ZTIMER_USEC) };
+
+        clist_foreach(&queue->event_list, _stamp, &stamp);
+        stats->depth = stats->posted;
+        stats->max_depth = stats->posted;
+    }
+    queue->stats = stats;
+    irq_restore(state);
+
+    if (was_attached) {
+        ztimer_release(ZTIMER_USEC);
+    }
+}
+
+void event_stats_post(event_queue_t *queue, event_t *event)
+{
+    event_queue_stats_t *stats = queue->stats;
+
+    event->enqueued = ztimer_now(ZTIMER_USEC);
+    stats->posted++;
+    if (++stats->depth > stats->max_depth) {
+        stats->max_depth = stats->depth;
+    }
+}
+
+void event_stats_take(event_queue_t *queue, const event_t *event)
+{
+    event_queue_stats_t *stats = queue->stats;
+
+    assert(stats->depth);
+    stats->depth--;
+    stats->handled++;
+
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - event->enqueued;
+    unsigned bucket = 0;
+
+    if (latency > stats->max_latency) {
+        stats->max_latency = latency;
+    }
+    if (latency) {
+        /* bitarithm_msb() takes an unsigned, which may be 16 bit wide */
+        bucket = (latency >> 16) ? 17 + bitarithm_msb(latency >> 16)
+                                 : 1 + bitarithm_msb(latency);
+    }
+    if (bucket >= CONFIG_EVENT_STATS_LATENCY_BUCKETS) {
+        bucket = CONFIG_EVENT_STATS_LATENCY_BUCKETS - 1;
+    }
+    stats->latency[bucket]++;
+}
+
+void event_stats_cancel(event_queue_t *queue)
+{
+    event_queue_stats_t *stats = queue->stats;
+
+    assert(stats->depth);
+    stats->depth--;
+}
+
+void event_queue_stats_print(const event_queue_stats_t *stats)
+{
+    printf("posted: %" PRIu32 ", handled: %" PRIu32 ", depth: %u, "
+           "max depth: %u, max latency: %" PRIu32 " us\n",
+           stats->posted, stats->handled, (unsigned)stats->depth,
+           (unsigned)stats->max_depth, stats->max_latency);
+    for (unsigned i = 0; i < CONFIG_EVENT_STATS_LATENCY_BUCKETS; i++) {
+        uint32_t lower = i ? 1UL << (i - 1) : 0;
+
+        if (i == CONFIG_EVENT_STATS_LATENCY_BUCKETS - 1) {
+            printf("%5" PRIu32 "+       us: %" PRIu32 "\n",
+                   lower, stats->latency[i]);
+        }
+        else {
+            uint32_t upper = i ? (1UL << i) - 1 : 0;
+            printf("%5" PRIu32 " - %5" PRIu32 " us: %" PRIu32 "\n",
+                   lower, upper, stats->latency[i]);
+        }
+    }
+}
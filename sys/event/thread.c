@@ -26,6 +26,10 @@
 #include "event.h"
 #include "event/thread.h"
 
+#if IS_USED(MODULE_EVENT_STATS)
+#include "event/stats.h"
+#endif
+
 struct event_queue_and_size {
     event_queue_t *q;
     size_t q_numof;
@@ -98,6 +102,20 @@ static char WORD_ALIGNED _evq_lowest_stack[EVENT_THREAD_LOWEST_STACKSIZE];
 
 event_queue_t event_thread_queues[EVENT_QUEUE_PRIO_NUMOF];
 
+#if IS_USED(MODULE_EVENT_STATS)
+event_queue_stats_t event_thread_stats[EVENT_QUEUE_PRIO_NUMOF];
+
+static void _attach_stats(void)
+{
+    for (unsigned i = 0; i < EVENT_QUEUE_PRIO_NUMOF; i++) {
+        event_queue_stats_attach(&event_thread_queues[i],
+                                 &event_thread_stats[i]);
+    }
+}
+#else
+static inline void _attach_stats(void) {}
+#endif
+
 void auto_init_event_thread(void)
 {
     if (IS_USED(MODULE_EVENT_THREAD_HIGHEST)) {
@@ -130,4 +148,6 @@ void auto_init_event_thread(void)
     event_thread_init_multi(qs, qs_numof,
                             _evq_medium_stack, sizeof(_evq_medium_stack),
                             EVENT_THREAD_MEDIUM_PRIO);
+
+    _attach_stats();
 }
@@ -136,6 +136,11 @@ extern "C" {
  */
 typedef struct event event_t;
 
+/**
+ * @brief   event queue statistics forward declaration, see @ref sys_event_stats
+ */
+typedef struct event_queue_stats event_queue_stats_t;
+
 /**
  * @brief   event handler type definition
  */
@@ -147,6 +152,10 @@ typedef void (*event_handler_t)(event_t *);
 struct event {
     clist_node_t list_node;     /**< event queue list entry             */
     event_handler_t handler;    /**< pointer to event handler function  */
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    uint32_t enqueued;          /**< time the event was queued, if the
+                                     queue has statistics attached      */
+#endif
 };
 
 /**
@@ -155,6 +164,10 @@ struct event {
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    event_queue_stats_t *stats; /**< statistics, see
+                                     event_queue_stats_attach()         */
+#endif
 } event_queue_t;
 
 /**
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_event_counted Counted events
+ * @ingroup     sys_event
+ * @brief       Events that accumulate the occurrences posted between two
+ *              dispatches
+ *
+ * Posting an event that is already queued is a no-op, so an event posted
+ * from a high-rate interrupt source is handled once per dispatch no matter
+ * how often it was posted. A counted event additionally records what was
+ * folded together: event_counted_post() counts the posts,
+ * event_counted_post_mask() accumulates a bitmask, e.g. of the pins or the
+ * radio flags that fired. The handler is called with the accumulated value,
+ * which is reset atomically right before, so no occurrence is lost and
+ * occurrences posted while the handler runs queue the event again.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _rx_handler(event_counted_t *event, uint32_t count)
+ * {
+ *     for (uint32_t i = 0; i < count; i++) {
+ *         [...]
+ *     }
+ * }
+ *
+ * static event_counted_t _rx_event = EVENT_COUNTED_INIT(_rx_handler);
+ *
+ * static void _rx_isr(void *arg)
+ * {
+ *     event_counted_post(EVENT_PRIO_MEDIUM, &_rx_event);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    Use either event_counted_post() or event_counted_post_mask() on an
+ *          event, not both.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Counted event API
+ */
+
+#ifndef EVENT_COUNTED_H
+#define EVENT_COUNTED_H
+
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Counted event structure forward declaration
+ */
+typedef struct event_counted event_counted_t;
+
+/**
+ * @brief   Counted event handler type
+ *
+ * @param[in]   event   the counted event
+ * @param[in]   value   number of posts or bitmask accumulated since the last
+ *                      call, never 0
+ */
+typedef void (*event_counted_handler_t)(event_counted_t *event, uint32_t value);
+
+/**
+ * @brief   Counted event structure
+ */
+struct event_counted {
+    event_t super;                      /**< event_t structure that gets
+                                             extended                       */
+    event_counted_handler_t handler;    /**< handler of the accumulated
+                                             occurrences                    */
+    uint32_t value;                     /**< accumulated count or bitmask   */
+};
+
+/**
+ * @brief   Counted event handler function (used internally)
+ *
+ * @internal
+ *
+ * @param[in]   event   counted event to process
+ */
+void _event_counted_handler(event_t *event);
+
+/**
+ * @brief   Counted event static initializer
+ *
+ * @param[in]   _handler    handler of the accumulated occurrences
+ */
+#define EVENT_COUNTED_INIT(_handler) \
+    { \
+        .super.handler = _event_counted_handler, \
+        .handler = _handler, \
+    }
+
+/**
+ * @brief   Counted event initialization function
+ *
+ * @param[out]  event       object to initialize
+ * @param[in]   handler     handler of the accumulated occurrences
+ */
+void event_counted_init(event_counted_t *event, event_counted_handler_t handler);
+
+/**
+ * @brief   Count an occurrence and queue a counted event
+ *
+ * The count saturates at UINT32_MAX.
+ *
+ * @note    Can be called from interrupt context.
+ *
+ * @param[in]   queue   queue to post the event to
+ * @param[in]   event   counted event to count the occurrence on
+ */
+void event_counted_post(event_queue_t *queue, event_counted_t *event);
+
+/**
+ * @brief   Add bits to the bitmask of a counted event and queue it
+ *
+ * @note    Can be called from interrupt context.
+ *
+ * @param[in]   queue   queue to post the event to
+ * @param[in]   event   counted event to add the bits to
+ * @param[in]   mask    bits to add, must not be 0
+ */
+void event_counted_post_mask(event_queue_t *queue, event_counted_t *event,
+                             uint32_t mask);
+
+/**
+ * @brief   Remove a counted event from a queue and discard its occurrences
+ *
+ * @param[in]   queue   queue to remove the event from
+ * @param[in]   event   counted event to cancel
+ */
+void event_counted_cancel(event_queue_t *queue, event_counted_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_COUNTED_H */
+/** @} */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_event_stats Event queue statistics
+ * @ingroup     sys_event
+ * @brief       Depth and latency statistics of event queues
+ *
+ * With the module `event_stats`, statistics can be attached to an event queue
+ * using event_queue_stats_attach(). The queue then keeps track of how many
+ * events were queued and handled, how many events were queued at most at the
+ * same time, and how long events waited in the queue until they were taken
+ * by event_get() or event_wait(). The waiting times are measured on
+ * `ZTIMER_USEC` and collected in a histogram.
+ *
+ * With `event_thread`, statistics are attached to the event thread queues
+ * (@ref EVENT_PRIO_HIGHEST, @ref EVENT_PRIO_MEDIUM and
+ * @ref EVENT_PRIO_LOWEST) automatically, see @ref event_thread_stats.
+ *
+ * Delayed work posted with @ref event_timeout_set() enters the queue when
+ * the timeout expires, so its waiting time does not include the delay.
+ *
+ * @note    Every @ref event_t grows by the enqueue timestamp with this module.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event queue statistics API
+ */
+
+#ifndef EVENT_STATS_H
+#define EVENT_STATS_H
+
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets of the waiting time histogram, 2 to 33
+ */
+#ifndef CONFIG_EVENT_STATS_LATENCY_BUCKETS
+#define CONFIG_EVENT_STATS_LATENCY_BUCKETS  (16U)
+#endif
+
+/**
+ * @brief   Event queue statistics
+ *
+ * Bucket 0 of @ref event_queue_stats::latency counts events handled within
+ * the same microsecond they were queued, bucket `n` counts waiting times of
+ * `2^(n-1)` to `2^n - 1` microseconds. The last bucket also counts all longer
+ * waiting times.
+ */
+struct event_queue_stats {
+    uint32_t posted;        /**< number of events queued */
+    uint32_t handled;       /**< number of events taken from the queue */
+    uint16_t depth;         /**< number of events currently queued */
+    uint16_t max_depth;     /**< maximum number of events queued at once */
+    uint32_t max_latency;   /**< longest waiting time in microseconds */
+    /** number of events per waiting time bucket */
+    uint32_t latency[CONFIG_EVENT_STATS_LATENCY_BUCKETS];
+};
+
+/**
+ * @brief   Attach statistics to an event queue
+ *
+ * @p stats is cleared. Events already queued on @p queue are accounted for as
+ * if they were posted when the statistics are attached.
+ *
+ * @pre     @p queue is initialized, event_queue_init() and friends detach the
+ *          statistics
+ *
+ * @param[in]   queue   event queue to collect the statistics of
+ * @param[out]  stats   statistics to collect, must stay valid as long as they
+ *                      are attached, NULL to detach them
+ */
+void event_queue_stats_attach(event_queue_t *queue, event_queue_stats_t *stats);
+
+/**
+ * @brief   Print event queue statistics
+ *
+ * @param[in]   stats   statistics to print
+ */
+void event_queue_stats_print(const event_queue_stats_t *stats);
+
+#if IS_USED(MODULE_EVENT_THREAD) || defined(DOXYGEN)
+/**
+ * @brief   Statistics of the event thread queues, indexed by
+ *          EVENT_QUEUE_PRIO_HIGHEST and friends
+ */
+extern event_queue_stats_t event_thread_stats[];
+#endif
+
+/**
+ * @name    Hooks used by the event queue implementation
+ *
+ * All functions must be called with interrupts disabled and only if
+ * event_queue_t::stats is set.
+ *
+ * @internal
+ * @{
+ */
+
+/**
+ * @brief   Account for an event that was queued
+ *
+ * @param[in]   queue   queue the event was queued in
+ * @param[in]   event   event that was queued
+ */
+void event_stats_post(event_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Account for an event that was taken from the queue
+ *
+ * @param[in]   queue   queue the event was taken from
+ * @param[in]   event   event that was taken from the queue
+ */
+void event_stats_take(event_queue_t *queue, const event_t *event);
+
+/**
+ * @brief   Account for an event that was cancelled
+ *
+ * @param[in]   queue   queue the event was removed from
+ */
+void event_stats_cancel(event_queue_t *queue);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_STATS_H */
+/** @} */
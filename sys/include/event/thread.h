@@ -45,6 +45,10 @@
  * Finally, the module [event_thread_lowest](@ref sys_event_thread_lowest) is
  * provided for backward compatibility and has no effect.
  *
+ * With the module [event_stats](@ref sys_event_stats), the depth and the
+ * waiting times of the three queues are recorded in @ref event_thread_stats,
+ * which helps choosing the queue and the stack size of the event threads.
+ *
  * @{
  *
  * @file
@@ -88,6 +88,58 @@ int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n);
  */
 int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buf, size_t count);
 
+/**
+ * @brief   Get the contiguous free space of the isrpipe's buffer
+ *
+ * Allows filling the buffer in place, e.g. by DMA. The data is passed on to
+ * the reader by isrpipe_write_commit().
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[out]  data        start of the free space
+ *
+ * @returns     number of bytes that can be written to @p data
+ * @returns     0 if buffer is full
+ */
+static inline size_t isrpipe_write_span(isrpipe_t *isrpipe, uint8_t **data)
+{
+    return tsrb_add_span(&isrpipe->tsrb, data);
+}
+
+/**
+ * @brief   Pass bytes written to the span returned by isrpipe_write_span()
+ *          on to the reader
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   n           number of bytes written
+ */
+void isrpipe_write_commit(isrpipe_t *isrpipe, size_t n);
+
+/**
+ * @brief   Get the contiguous data at the start of the isrpipe's buffer
+ *          (blocking)
+ *
+ * Allows parsing the data in place instead of copying it out with
+ * isrpipe_read(). The data stays in the buffer until isrpipe_read_commit()
+ * is called.
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[out]  data        start of the data
+ *
+ * @returns     number of bytes that can be read from @p data
+ */
+size_t isrpipe_read_span(isrpipe_t *isrpipe, const uint8_t **data);
+
+/**
+ * @brief   Remove bytes read from the span returned by isrpipe_read_span()
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   n           number of bytes read
+ */
+static inline void isrpipe_read_commit(isrpipe_t *isrpipe, size_t n)
+{
+    tsrb_get_commit(&isrpipe->tsrb, n);
+}
+
 #ifdef __cplusplus
 }
 #endif
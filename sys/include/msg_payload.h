@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_msg_payload Zero-copy message payloads
+ * @ingroup     sys
+ * @brief       Pass reference counted buffers between threads with msg_t
+ *
+ *              A @ref msg_t only carries a 32-bit value or a pointer. This
+ *              module hands over larger payloads (e.g. sensor frames) without
+ *              copying them: the producer takes a buffer from a
+ *              @ref msg_payload_pool_t, fills it and sends a pointer to it
+ *              with @ref msg_payload_send(). The message transfers the
+ *              producer's reference to the receiver, which gets the buffer
+ *              back with @ref msg_payload_get() and returns it to its pool with
+ *              @ref msg_payload_release() once done.
+ *
+ *              Buffers are reference counted. To hand the same buffer to
+ *              several threads, take an additional reference with
+ *              @ref msg_payload_hold() for each extra message. A buffer is
+ *              returned to its pool when its last reference is released.
+ *
+ *              If a message can not be delivered (invalid pid, or the receiver
+ *              is not ready when sending from an ISR or with
+ *              @ref msg_payload_try_send()), the reference it carried is
+ *              released, so dropped messages never leak buffers.
+ *
+ *              Pools are built on top of @ref sys_memarray, all functions may
+ *              be called from interrupt context except for the blocking
+ *              @ref msg_payload_send() which then behaves like msg_send().
+ *
+ *              ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ *              static MSG_PAYLOAD_POOL_BUF(frames_buf, 64, 4);
+ *              static msg_payload_pool_t frames;
+ *
+ *              msg_payload_pool_init(&frames, frames_buf, 64, 4);
+ *
+ *              msg_payload_t *p = msg_payload_alloc(&frames, 64);
+ *              sensor_read(msg_payload_data(p), p->len);
+ *              msg_payload_send(&msg, MSG_TYPE_FRAME, p, consumer_pid);
+ *
+ *              // in the consumer
+ *              msg_receive(&msg);
+ *              msg_payload_t *p = msg_payload_get(&msg, MSG_TYPE_FRAME);
+ *              process(msg_payload_data(p), p->len);
+ *              msg_payload_release(p);
+ *              ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Zero-copy message payloads
+ *
+ */
+#ifndef MSG_PAYLOAD_H
+#define MSG_PAYLOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memarray.h"
+#include "msg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   A pool of equally sized payload buffers
+ */
+typedef struct {
+    memarray_t mem;             /**< free buffers */
+    uint16_t size;              /**< capacity of each buffer in bytes */
+} msg_payload_pool_t;
+
+/**
+ * @brief   Header of a payload buffer, the data follows right behind it
+ */
+typedef struct {
+    msg_payload_pool_t *pool;   /**< pool the buffer is returned to */
+    uint16_t len;               /**< number of valid bytes in the buffer */
+    uint8_t refs;               /**< number of references, do not modify */
+} msg_payload_t;
+
+/**
+ * @brief   Memory used by a single buffer of @p size bytes, including its
+ *          header
+ *
+ * Rounded up to a multiple of the pointer size, so every buffer (and its data)
+ * stays pointer aligned.
+ */
+#define MSG_PAYLOAD_ELEM_SIZE(size) \
+    (sizeof(msg_payload_t) + \
+     (((size) + sizeof(void *) - 1) & ~(sizeof(void *) - 1)))
+
+/**
+ * @brief   Define a suitably aligned array holding @p num buffers of
+ *          @p size bytes each
+ *
+ * @param[in]   name    name of the array
+ * @param[in]   size    capacity of each buffer in bytes
+ * @param[in]   num     number of buffers
+ */
+#define MSG_PAYLOAD_POOL_BUF(name, size, num) \
+    void *name[(MSG_PAYLOAD_ELEM_SIZE(size) * (num)) / sizeof(void *)]
+
+/**
+ * @brief   Initialize a payload pool
+ *
+ * @pre     @p buf was defined with @ref MSG_PAYLOAD_POOL_BUF using the same
+ *          @p size and @p num
+ *
+ * @param[out]  pool    pool to initialize
+ * @param[in]   buf     memory of the buffers
+ * @param[in]   size    capacity of each buffer in bytes
+ * @param[in]   num     number of buffers
+ */
+void msg_payload_pool_init(msg_payload_pool_t *pool, void *buf, uint16_t size,
+                           size_t num);
+
+/**
+ * @brief   Get the number of free buffers of a pool
+ *
+ * @param[in]   pool    pool to check
+ *
+ * @return  number of buffers that can be allocated
+ */
+size_t msg_payload_pool_available(msg_payload_pool_t *pool);
+
+/**
+ * @brief   Take a buffer from a pool
+ *
+ * The caller holds the only reference to the new buffer.
+ *
+ * @param[in]   pool    pool to take the buffer from
+ * @param[in]   len     number of bytes that will be used, stored in
+ *                      msg_payload_t::len
+ *
+ * @return  the buffer, its data is not cleared
+ * @return  NULL if @p len exceeds the buffer size or the pool is empty
+ */
+msg_payload_t *msg_payload_alloc(msg_payload_pool_t *pool, size_t len);
+
+/**
+ * @brief   Get the data of a payload buffer
+ *
+ * @param[in]   payload     buffer
+ *
+ * @return  pointer to the msg_payload_pool_t::size bytes of data
+ */
+static inline void *msg_payload_data(msg_payload_t *payload)
+{
+    return payload + 1;
+}
+
+/**
+ * @brief   Take an additional reference to a buffer
+ *
+ * @pre     The caller holds a reference to @p payload
+ *
+ * @param[in]   payload     buffer
+ */
+void msg_payload_hold(msg_payload_t *payload);
+
+/**
+ * @brief   Drop a reference to a buffer
+ *
+ * The buffer is returned to its pool when the last reference is dropped.
+ *
+ * @param[in]   payload     buffer, NULL is ignored
+ */
+void msg_payload_release(msg_payload_t *payload);
+
+/**
+ * @brief   Send a buffer to a thread (blocking)
+ *
+ * Hands the caller's reference to @p payload over to the receiver. If the
+ * message is not delivered the reference is released.
+ *
+ * @param[out]  m           message to send
+ * @param[in]   type        type of the message
+ * @param[in]   payload     buffer to send
+ * @param[in]   target_pid  PID of the receiver
+ *
+ * @return  the return value of msg_send()
+ */
+int msg_payload_send(msg_t *m, uint16_t type, msg_payload_t *payload,
+                     kernel_pid_t target_pid);
+
+/**
+ * @brief   Send a buffer to a thread (non-blocking)
+ *
+ * Hands the caller's reference to @p payload over to the receiver. If the
+ * message is not delivered the reference is released.
+ *
+ * @param[out]  m           message to send
+ * @param[in]   type        type of the message
+ * @param[in]   payload     buffer to send
+ * @param[in]   target_pid  PID of the receiver
+ *
+ * @return  the return value of msg_try_send()
+ */
+int msg_payload_try_send(msg_t *m, uint16_t type, msg_payload_t *payload,
+                         kernel_pid_t target_pid);
+
+/**
+ * @brief   Get the buffer carried by a received message
+ *
+ * The receiver owns the reference carried by the message and has to release
+ * it when done.
+ *
+ * @param[in]   m       received message
+ * @param[in]   type    expected type of the message
+ *
+ * @return  the buffer
+ * @return  NULL if @p m is not of type @p type
+ */
+static inline msg_payload_t *msg_payload_get(const msg_t *m, uint16_t type)
+{
+    return (m->type == type) ? m->content.ptr : NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSG_PAYLOAD_H */
+/** @} */
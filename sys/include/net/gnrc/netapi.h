@@ -54,6 +54,66 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_batch   Packet chain extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Pass several received packets in one message
+ * @{
+ * @details The submodule `gnrc_netapi_batch` lets a network module collect
+ *          received packets in a @ref gnrc_netapi_batch_t and pass them on
+ *          as a chain, linked by @ref gnrc_pktsnip_t::next_pkt, in a single
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message. This saves a message
+ *          and a context switch per packet when frames arrive back-to-back.
+ *
+ *          Only threads that registered with
+ *          @ref GNRC_NETREG_ENTRY_INIT_BATCH get chains, and only if they
+ *          are the sole subscriber to the type and demux context. All other
+ *          subscribers still get one @ref GNRC_NETAPI_MSG_TYPE_RCV message
+ *          per packet. `gnrc_netif`, `gnrc_ipv6` and `gnrc_udp` use chains
+ *          on the receive path when the module is used. The send path is
+ *          not batched.
+ *
+ * To use, add the module `gnrc_netapi_batch` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_batch
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
+ *
+ * @defgroup    net_gnrc_netapi_direct   Run-to-completion extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Handle received packets without a thread switch per layer
+ * @{
+ * @details The submodule `gnrc_netapi_direct` lets `gnrc_sixlowpan`,
+ *          `gnrc_ipv6` and `gnrc_udp` register with a
+ *          @ref gnrc_netreg_entry_direct_t. A received packet dispatched to
+ *          such a module is handled by a direct function call in the
+ *          context of the dispatching thread. So a packet received by
+ *          `gnrc_netif` usually runs up to the socket in the thread of the
+ *          interface, without a message and a context switch per layer.
+ *
+ *          The threads of the modules stay. They handle everything else,
+ *          and get the received packets as usual while they are busy,
+ *          i.e. unless they wait for messages with nothing queued.
+ *          `gnrc_ipv6` handles the IPv6 header and its extension headers
+ *          directly, but passes ICMPv6 on to its thread, as the neighbor
+ *          discovery may call into the interface synchronously. Packets
+ *          that are sent are never handled directly.
+ *
+ *          The module saves the message and context switch per layer, it
+ *          does not save RAM: the threads of the modules need their stacks
+ *          and queues for the packets sent, ICMPv6 and the fallback, and
+ *          the stack of every interface thread is increased by
+ *          @ref GNRC_NETIF_DIRECT_EXTRA_STACKSIZE.
+ *
+ * To use, add the module `gnrc_netapi_direct` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_direct
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -93,6 +153,21 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a chain of @ref net_gnrc_pkt up the
+ *          network stack
+ *
+ * `content.ptr` points to the first packet, the following packets are linked
+ * by @ref gnrc_pktsnip_t::next_pkt. The receiver owns all packets of the
+ * chain.
+ *
+ * @note    Only sent with @ref net_gnrc_netapi_batch to threads registered
+ *          with @ref GNRC_NETREG_ENTRY_INIT_BATCH.
+ *
+ * @note    0x0206 is taken by @ref GNRC_NETERR_MSG_TYPE.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0207)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -261,6 +336,83 @@ static inline int gnrc_netapi_set(kernel_pid_t pid, netopt_t opt,
                                 GNRC_NETAPI_MSG_TYPE_SET);
 }
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @defgroup net_gnrc_netapi_batch_conf GNRC netapi packet chain compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Maximum number of packets in a @ref gnrc_netapi_batch_t
+ *
+ * A full batch is passed on right away.
+ */
+#ifndef CONFIG_GNRC_NETAPI_BATCH_SIZE
+#define CONFIG_GNRC_NETAPI_BATCH_SIZE   (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Received packets waiting to be passed on as a chain
+ *
+ * All packets of a batch go to the same type and demux context. Initialize
+ * with all zeros.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ */
+typedef struct {
+    gnrc_pktsnip_t *head;       /**< first packet of the chain */
+    gnrc_pktsnip_t *tail;       /**< last packet of the chain */
+    uint32_t demux_ctx;         /**< demux context of the packets */
+    gnrc_nettype_t type;        /**< type of the packets */
+    uint8_t numof;              /**< number of packets in the chain */
+} gnrc_netapi_batch_t;
+
+/**
+ * @brief   Sends a chain of packets to all subscribers to
+ *          (@p type, @p demux_ctx)
+ *
+ * If there is exactly one subscriber and it registered with
+ * @ref GNRC_NETREG_ENTRY_INIT_BATCH, the whole chain is sent in a single
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message. Otherwise every packet is
+ * dispatched on its own as with @ref gnrc_netapi_dispatch_receive().
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      first packet of the chain, linked by
+ *                      @ref gnrc_pktsnip_t::next_pkt
+ *
+ * @return  Number of subscribers to (@p type, @p demux_ctx). If 0, the
+ *          packets of the chain were not touched and are still owned by the
+ *          caller.
+ */
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *pkts);
+
+/**
+ * @brief   Passes the packets of @p batch on and empties it
+ *
+ * Packets nobody subscribed to are released.
+ *
+ * @param[in,out] batch The batch to flush
+ */
+void gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch);
+
+/**
+ * @brief   Adds a received packet to @p batch
+ *
+ * The batch is flushed before if it holds packets for another type or demux
+ * context, and after if it is full.
+ *
+ * @param[in,out] batch     The batch to add to
+ * @param[in] type          protocol type of the targeted network module.
+ * @param[in] demux_ctx     demultiplexing context for @p type.
+ * @param[in] pkt           the received packet
+ */
+void gnrc_netapi_batch_add(gnrc_netapi_batch_t *batch, gnrc_nettype_t type,
+                           uint32_t demux_ctx, gnrc_pktsnip_t *pkt);
+#endif /* defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN) */
+
 #ifdef __cplusplus
 }
 #endif
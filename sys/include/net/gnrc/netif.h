@@ -216,6 +216,16 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets not yet passed up the stack
+     *
+     * Passed on once all pending events of the interface are handled.
+     *
+     * @note    Only available with @ref net_gnrc_netapi_batch.
+     */
+    gnrc_netapi_batch_t rx_batch;
 #endif
     /**
      * @brief   Message queue for the netif thread
@@ -275,6 +285,29 @@ static inline bool gnrc_netif_netdev_new_api(gnrc_netif_t *netif)
     return !gnrc_netif_netdev_legacy_api(netif);
 }
 
+/**
+ * @brief   Get the number of bytes to allocate for the frame the device
+ *          received
+ *
+ * If the device supports one-pass receive (see @ref NETOPT_RX_ONE_PASS),
+ * @p max_len is returned right away, so the frame can be received into a
+ * buffer of that size with a single call to @ref netdev_driver_t::recv.
+ * Otherwise, the size of the frame is queried from the device.
+ *
+ * @param[in] netif     The network interface.
+ * @param[in] max_len   Maximum size of a frame of the device.
+ *
+ * @return  the number of bytes to allocate for the frame
+ * @return  <= 0, if there is no frame to receive
+ */
+static inline int gnrc_netif_netdev_rx_len(gnrc_netif_t *netif, size_t max_len)
+{
+    if (netif->flags & GNRC_NETIF_FLAGS_RX_ONE_PASS) {
+        return max_len;
+    }
+    return netif->dev->driver->recv(netif->dev, NULL, 0, NULL);
+}
+
 /**
  * @see gnrc_netif_ops_t
  */
@@ -145,6 +145,13 @@ enum {
  * @brief   Network interface is configured in raw mode
  */
 #define GNRC_NETIF_FLAGS_RAWMODE                   (0x00010000U)
+
+/**
+ * @brief   The device supports one-pass receive
+ *
+ * @see @ref NETOPT_RX_ONE_PASS
+ */
+#define GNRC_NETIF_FLAGS_RX_ONE_PASS               (0x00020000U)
 /** @} */
 
 #ifdef __cplusplus
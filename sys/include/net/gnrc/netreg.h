@@ -17,6 +17,30 @@
  *          @ref net_gnrc_netapi.
  *
  * @author  Martine Lenders <mlenders@inf.fu-berlin.de>
+ *
+ * @defgroup    net_gnrc_netreg_hash    Hash index extension
+ * @ingroup     net_gnrc_netreg
+ * @brief       Constant time lookups for @ref net_gnrc_netreg
+ * @{
+ * @details By default, the registry keeps a list per type, and every lookup
+ *          walks the list of the type. With many sockets on different ports
+ *          this makes every received packet pay for all of them.
+ *
+ *          The submodule `gnrc_netreg_hash` keeps the registry in an
+ *          open-addressing hash index keyed by type and demux context
+ *          instead. Entries with the same key are linked by
+ *          gnrc_netreg_entry_t::next, so @ref gnrc_netreg_lookup(),
+ *          @ref gnrc_netreg_getnext() and @ref gnrc_netreg_num() no longer
+ *          depend on the number of other registrations. Every distinct key
+ *          takes a slot of the index, see @ref CONFIG_GNRC_NETREG_HASH_SIZE.
+ *
+ * To use, add the module `gnrc_netreg_hash` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netreg_hash
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 #ifndef NET_GNRC_NETREG_H
 #define NET_GNRC_NETREG_H
@@ -30,12 +54,18 @@
 #ifdef MODULE_GNRC_NETAPI_MBOX
 #include "mbox.h"
 #endif
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+#include <stdbool.h>
+
+#include "mutex.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(MODULE_GNRC_NETAPI_DIRECT) || \
     defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
@@ -69,9 +99,47 @@ typedef enum {
      */
     GNRC_NETREG_TYPE_CB,
 #endif
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Use [default IPC](@ref core_msg) for
+     *          [netapi](@ref net_gnrc_netapi) operations, but accept
+     *          packet chains in @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+     *
+     * @note    Only available with `gnrc_netapi_batch` module.
+     */
+    GNRC_NETREG_TYPE_BATCH,
+#endif
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+    /**
+     * @brief   Handle received packets in the context of the dispatching
+     *          thread if possible, use [default IPC](@ref core_msg)
+     *          otherwise
+     *
+     * @note    Only available with `gnrc_netapi_direct` module.
+     */
+    GNRC_NETREG_TYPE_DIRECT,
+#endif
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC network registry compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of slots of the @ref net_gnrc_netreg_hash "hash index"
+ *
+ * Every registered combination of type and demux context takes a slot.
+ * Registering more fails with `-ENOMEM`. Lookups get slower as the index
+ * fills up, so keep this well above the number of combinations, e.g. twice
+ * the number of sockets.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_SIZE
+#define CONFIG_GNRC_NETREG_HASH_SIZE    (32U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -93,7 +161,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(MODULE_GNRC_NETAPI_DIRECT)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -101,6 +170,42 @@ typedef enum {
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
 #endif
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry statically with PID of a thread that
+ *          handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @return  An initialized netreg entry
+ */
+#define GNRC_NETREG_ENTRY_INIT_BATCH(demux_ctx, pid) { NULL, demux_ctx, \
+                                                       GNRC_NETREG_TYPE_BATCH, \
+                                                       { pid } }
+#endif
+
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry statically with a module that handles
+ *          received packets in the context of the dispatching thread
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] _direct   Target module for the registry entry
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ *
+ * @return  An initialized netreg entry
+ */
+#define GNRC_NETREG_ENTRY_INIT_DIRECT(demux_ctx, _direct) { NULL, demux_ctx, \
+                                                            GNRC_NETREG_TYPE_DIRECT, \
+                                                            { .direct = _direct } }
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry statically with mbox
@@ -161,6 +266,40 @@ typedef struct {
 } gnrc_netreg_entry_cbd_t;
 #endif
 
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Packet handler of a module that handles received packets in the
+ *          context of the dispatching thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ *
+ * @param[in] pkt   The received packet.
+ *
+ * @return  true, if @p pkt was handled
+ * @return  false, if @p pkt was not touched and has to be passed to the
+ *          thread of the module instead
+ */
+typedef bool (*gnrc_netreg_entry_direct_cb_t)(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Descriptor of a module that handles received packets in the
+ *          context of the dispatching thread
+ *
+ * The thread of the module has to hold gnrc_netreg_entry_direct_t::lock
+ * while it handles a message and must wait for messages with msg_receive()
+ * only. Packets are handled directly only while the thread waits there, so
+ * they never overtake a message the thread already received.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ */
+typedef struct {
+    gnrc_netreg_entry_direct_cb_t recv; /**< handler for received packets */
+    mutex_t lock;                       /**< held while the module is busy */
+    kernel_pid_t pid;                   /**< thread of the module, gets the
+                                         *   packets while it is busy */
+} gnrc_netreg_entry_direct_t;
+#endif
+
 /**
  * @brief   Entry to the @ref net_gnrc_netreg
  */
@@ -181,6 +320,7 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(MODULE_GNRC_NETAPI_DIRECT) || \
     defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
@@ -209,6 +349,15 @@ typedef struct gnrc_netreg_entry {
          */
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
+
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+        /**
+         * @brief   Target module for the registry entry
+         *
+         * @note    Only available with @ref net_gnrc_netapi_direct.
+         */
+        gnrc_netreg_entry_direct_t *direct;
+#endif
     } target;                   /**< Target for the registry entry */
 } gnrc_netreg_entry_t;
 
@@ -275,12 +424,36 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(MODULE_GNRC_NETAPI_DIRECT)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
 }
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with PID of a thread that
+ *          handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ */
+static inline void gnrc_netreg_entry_init_batch(gnrc_netreg_entry_t *entry,
+                                                uint32_t demux_ctx,
+                                                kernel_pid_t pid)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_BATCH;
+    entry->target.pid = pid;
+}
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry dynamically with mbox
@@ -324,6 +497,29 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->target.cbd = cbd;
 }
 #endif
+
+#if defined(MODULE_GNRC_NETAPI_DIRECT) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with a module that handles
+ *          received packets in the context of the dispatching thread
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] direct    Target module for the registry entry
+ *
+ * @note    Only available with @ref net_gnrc_netapi_direct.
+ */
+static inline void gnrc_netreg_entry_init_direct(gnrc_netreg_entry_t *entry,
+                                                 uint32_t demux_ctx,
+                                                 gnrc_netreg_entry_direct_t *direct)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_DIRECT;
+    entry->target.direct = direct;
+}
+#endif
 /** @} */
 
 /**
@@ -349,6 +545,7 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  *
  * @return  0 on success
  * @return  -EINVAL if @p type was < GNRC_NETTYPE_UNDEF or >= GNRC_NETTYPE_NUMOF
+ * @return  -ENOMEM if the @ref net_gnrc_netreg_hash "hash index" is full
  */
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry);
 
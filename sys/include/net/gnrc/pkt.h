@@ -121,6 +121,15 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Next packet in a @ref net_gnrc_netapi_batch "packet chain"
+     *
+     * Only valid in the first snip of a packet that is passed in a
+     * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message.
+     */
+    struct gnrc_pktsnip *next_pkt;
+#endif
 } gnrc_pktsnip_t;
 
 /**
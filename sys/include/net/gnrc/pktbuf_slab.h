@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_pktbuf_slab   Size class packet buffer
+ * @ingroup     net_gnrc_pktbuf
+ * @brief       Packet buffer backend with separate pools of fixed size blocks
+ *
+ * The `gnrc_pktbuf_slab` backend replaces the first-fit arena of
+ * `gnrc_pktbuf_static` with one pool for the packet snip descriptors and
+ * three pools of equally sized data blocks:
+ *
+ * | Pool   | Typical content                                  |
+ * |:------ |:------------------------------------------------ |
+ * | snips  | @ref gnrc_pktsnip_t descriptors                  |
+ * | small  | headers, e.g. netif, IPv6, UDP or 6LoWPAN        |
+ * | medium | IEEE 802.15.4 frames and 6LoWPAN fragments       |
+ * | large  | full-MTU IPv6 packets and Ethernet frames        |
+ *
+ * Data goes into the smallest class it fits in, or into the next larger one
+ * if that class is exhausted. Allocation and release take constant time, and
+ * as blocks are never split, mixed traffic can not fragment the buffer: a
+ * full-MTU packet gets a block as long as one of the large blocks is free.
+ * The price is the space wasted at the end of partly used blocks, which is
+ * tracked in @ref gnrc_pktbuf_slab_class_stats_t::requested.
+ *
+ * Enable with `USEMODULE += gnrc_pktbuf_slab`. @ref CONFIG_GNRC_PKTBUF_SIZE
+ * is not used by this backend, the pools are sized with the configurations
+ * below.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Size class packet buffer definitions
+ */
+#ifndef NET_GNRC_PKTBUF_SLAB_H
+#define NET_GNRC_PKTBUF_SLAB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_pktbuf_slab_conf GNRC size class packet buffer compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of packet snip descriptors
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32U)
+#endif
+
+/**
+ * @brief   Size of the blocks of the small class in bytes
+ *
+ * @note    Has to be a multiple of 8.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (48U)
+#endif
+
+/**
+ * @brief   Number of blocks of the small class
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16U)
+#endif
+
+/**
+ * @brief   Size of the blocks of the medium class in bytes
+ *
+ * @note    Has to be a multiple of 8.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (128U)
+#endif
+
+/**
+ * @brief   Number of blocks of the medium class
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF    (6U)
+#endif
+
+/**
+ * @brief   Size of the blocks of the large class in bytes
+ *
+ * This is the largest data size the packet buffer can hold. The default fits
+ * an IPv6 packet of the minimum MTU, or an Ethernet frame if an Ethernet
+ * device is compiled in.
+ *
+ * @note    Has to be a multiple of 8.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#ifdef MODULE_NETDEV_ETH
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1536U)
+#else
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1280U)
+#endif
+#endif
+
+/**
+ * @brief   Number of blocks of the large class
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (6U)
+#endif
+/** @} */
+
+/**
+ * @brief   The pools of the packet buffer
+ */
+enum {
+    GNRC_PKTBUF_SLAB_SNIPS,             /**< packet snip descriptors */
+    GNRC_PKTBUF_SLAB_SMALL,             /**< small data blocks */
+    GNRC_PKTBUF_SLAB_MEDIUM,            /**< medium data blocks */
+    GNRC_PKTBUF_SLAB_LARGE,             /**< large data blocks */
+    GNRC_PKTBUF_SLAB_CLASS_NUMOF,       /**< number of pools */
+};
+
+/**
+ * @brief   Usage statistics of a pool
+ */
+typedef struct {
+    uint16_t size;          /**< size of a block in bytes */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of blocks in use */
+    uint16_t max_used;      /**< high-water mark of @p used */
+    uint32_t requested;     /**< bytes requested for the blocks in use,
+                                 `used * size - requested` is the space
+                                 wasted at the end of the blocks */
+    uint32_t allocs;        /**< number of successful allocations */
+    uint32_t fallbacks;     /**< allocations that took a block of this
+                                 class as the smaller classes were
+                                 exhausted */
+    uint32_t fails;         /**< allocations that failed as this and all
+                                 larger classes were exhausted */
+} gnrc_pktbuf_slab_class_stats_t;
+
+/**
+ * @brief   Get the usage statistics of the packet buffer
+ *
+ * @param[out]  stats   statistics of the pools, indexed by
+ *                      @ref GNRC_PKTBUF_SLAB_SNIPS and following
+ */
+void gnrc_pktbuf_slab_get_stats(gnrc_pktbuf_slab_class_stats_t stats[GNRC_PKTBUF_SLAB_CLASS_NUMOF]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PKTBUF_SLAB_H */
+/** @} */
@@ -158,6 +158,15 @@ typedef enum {
      * set if the source address matches one from the table.
      */
     IEEE802154_CAP_SRC_ADDR_MATCH       = BIT18,
+    /**
+     * @brief the device can read a frame without getting its length first.
+     *
+     * @ref ieee802154_radio_ops::read can be called with a buffer of
+     * @ref IEEE802154_FRAME_LEN_MAX bytes without calling
+     * @ref ieee802154_radio_ops::len before and returns the actual length
+     * of the frame.
+     */
+    IEEE802154_CAP_RX_ONE_PASS          = BIT19,
 } ieee802154_rf_caps_t;
 
 /**
@@ -1530,6 +1539,22 @@ static inline bool ieee802154_radio_has_phy_mr_fsk(ieee802154_dev_t *dev)
     return (dev->driver->caps & IEEE802154_CAP_PHY_MR_FSK);
 }
 
+/**
+ * @brief Check if the device supports one-pass receive
+ *
+ * Internally this function reads ieee802154_radio_ops::caps and checks for
+ * @ref IEEE802154_CAP_RX_ONE_PASS.
+ *
+ * @param[in] dev IEEE802.15.4 device descriptor
+ *
+ * @return true if the device has support
+ * @return false otherwise
+ */
+static inline bool ieee802154_radio_has_rx_one_pass(ieee802154_dev_t *dev)
+{
+    return (dev->driver->caps & IEEE802154_CAP_RX_ONE_PASS);
+}
+
 /**
  * @brief Get supported PHY modes of the device.
  *
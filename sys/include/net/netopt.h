@@ -828,6 +828,20 @@ typedef enum {
      * @brief   (array of byte arrays) Leave an link layer multicast group
      */
     NETOPT_L2_GROUP_LEAVE,
+
+    /**
+     * @brief   (@ref netopt_enable_t) device supports one-pass receive
+     *
+     * If enabled, @ref netdev_driver_t::recv can be called with a buffer
+     * that is large enough for any frame of the device, without querying
+     * the size of the frame first. The driver writes the frame directly into
+     * that buffer and returns its actual size. Dropping a frame with
+     * `buf == NULL` and `len > 0` works without a prior size query as well.
+     *
+     * This option is read-only.
+     */
+    NETOPT_RX_ONE_PASS,
+
     /**
      * @brief   maximum number of options defined here.
      *
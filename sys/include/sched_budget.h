@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sched_budget CPU Time Budgets
+ * @ingroup     sys
+ * @brief       Limits the CPU time of single threads to a budget per period
+ *
+ *              A thread with a reservation may run for at most `budget`
+ *              microseconds within each `period`. Once the budget is used up
+ *              the thread is taken off its runqueue (it shows up as stopped)
+ *              until the budget is replenished at the end of the period, so a
+ *              runaway thread can not starve the threads below its priority.
+ *
+ *              The run time of the threads is measured at every context
+ *              switch, a single ZTIMER_USEC timer enforces the budget of the
+ *              running thread. A thread's period starts when it runs for the
+ *              first time after its previous period ended, like the
+ *              replenishment of a sporadic server. Threads without a
+ *              reservation are not affected.
+ *
+ *              Reservations are set with @ref sched_budget_set() or with the
+ *              thread_attr_t::budget and thread_attr_t::period attributes when
+ *              creating a thread with thread_create_ext(). `ps` shows how
+ *              often each thread was throttled.
+ *
+ * @{
+ *
+ * @file
+ * @brief       CPU Time Budgets
+ *
+ */
+#ifndef SCHED_BUDGET_H
+#define SCHED_BUDGET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(CONFIG_SCHED_BUDGET_NUMOF) || defined(DOXYGEN)
+/**
+ * @brief   Maximum number of threads with a reservation
+ */
+#define CONFIG_SCHED_BUDGET_NUMOF   4
+#endif
+
+/**
+ * @brief   Set or remove the CPU time reservation of a thread
+ *
+ * A new reservation starts with a full budget. Changing the reservation of a
+ * throttled thread takes effect once it is replenished, removing it resumes
+ * the thread right away.
+ *
+ * @param[in]   pid     thread to limit
+ * @param[in]   budget  CPU time in microseconds the thread may use per
+ *                      @p period, 0 to remove the reservation
+ * @param[in]   period  period in microseconds
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p pid is invalid or @p budget is larger than @p period
+ * @return  -ENOMEM if there are already @ref CONFIG_SCHED_BUDGET_NUMOF
+ *          reservations
+ */
+int sched_budget_set(kernel_pid_t pid, uint32_t budget, uint32_t period);
+
+/**
+ * @brief   Check whether a thread has a CPU time reservation
+ *
+ * @param[in]   pid     thread to check
+ *
+ * @return  true if @p pid has a reservation
+ */
+bool sched_budget_is_limited(kernel_pid_t pid);
+
+/**
+ * @brief   Get the number of times a thread got throttled
+ *
+ * @param[in]   pid     thread to get the counter of
+ *
+ * @return  number of times @p pid used up its budget, 0 for threads without
+ *          a reservation
+ */
+unsigned sched_budget_throttled(kernel_pid_t pid);
+
+/**
+ * @brief   Release the reservation of an exiting thread
+ *
+ * @warning This API is not intended for out of tree users, it is called by
+ *          the scheduler with interrupts disabled.
+ *
+ * @param[in]   pid     thread that exits
+ */
+void sched_budget_thread_exit(kernel_pid_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_BUDGET_H */
+/** @} */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sched_edf Earliest Deadline First Scheduling
+ * @ingroup     sys
+ * @brief       This module adds an earliest deadline first (EDF) scheduling
+ *              class on top of the fixed priorities.
+ *
+ *              All threads admitted with @ref sched_edf_admit() share the
+ *              priority @ref SCHED_EDF_PRIO. Among each other they are not
+ *              scheduled in FIFO order, but by their absolute deadline: the
+ *              runqueue of that priority is kept sorted, so the thread with
+ *              the earliest deadline is always in front. Threads of a higher
+ *              priority still preempt EDF threads, threads of a lower priority
+ *              only run while no EDF thread is runnable.
+ *
+ *              Admission control keeps the sum of the utilizations
+ *              (runtime / period) of all admitted threads below
+ *              @ref SCHED_EDF_UTILIZATION_MAX. A job that completes (the
+ *              thread sets its next deadline) after its deadline passed is
+ *              counted as a deadline miss, the counters are shown by `ps`.
+ *
+ *              A typical periodic thread looks like:
+ *
+ *                  sched_edf_admit(thread_get_active(), runtime, period);
+ *                  uint32_t release = ztimer_now(SCHED_EDF_TIMERBASE);
+ *                  while (1) {
+ *                      do_work();
+ *                      release += period;
+ *                      thread_set_deadline(thread_get_active(), release + period);
+ *                      ztimer_sleep_until(release);
+ *                  }
+ *
+ *              @ref SCHED_EDF_PRIO defaults to the priority right below
+ *              main, which no thread in the tree uses. Threads that share
+ *              the priority without being admitted only run once no EDF
+ *              thread is runnable, so the priorities of the GNRC threads and
+ *              the levels of @ref sched_feedback are rejected at compile
+ *              time. To keep main and the shell from delaying the EDF
+ *              threads, choose a higher priority that no other thread of the
+ *              application uses.
+ *
+ * @warning     @ref SCHED_EDF_PRIO must not be scheduled by
+ *              @ref sched_round_robin or @ref sched_feedback, as they would
+ *              reorder its runqueue.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduling
+ *
+ */
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "clist.h"
+#include "sched.h"
+#include "thread_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(SCHED_EDF_PRIO) || defined(DOXYGEN)
+/**
+ * @brief   Priority band of the EDF threads
+ */
+#define SCHED_EDF_PRIO              (THREAD_PRIORITY_MAIN + 1)
+#endif
+
+#if !defined(SCHED_EDF_TIMERBASE) || defined(DOXYGEN)
+/**
+ * @brief   ztimer whose ticks deadlines, runtimes and periods are given in
+ *
+ * @details Defaults to ZTIMER_USEC if available else it uses ZTIMER_MSEC
+ */
+#if MODULE_ZTIMER_USEC
+#define SCHED_EDF_TIMERBASE         ZTIMER_USEC
+#else
+#define SCHED_EDF_TIMERBASE         ZTIMER_MSEC
+#endif
+#endif
+
+#if !defined(SCHED_EDF_UTILIZATION_MAX) || defined(DOXYGEN)
+/**
+ * @brief   Maximum total utilization of all admitted threads in percent
+ *
+ * @details Values below 100 leave room for the threads of higher priority
+ *          and for interrupts.
+ */
+#define SCHED_EDF_UTILIZATION_MAX   100
+#endif
+
+/**
+ * @brief   Admit a thread to the EDF class
+ *
+ * The thread is moved to @ref SCHED_EDF_PRIO and gets its first deadline one
+ * @p period from now. Admitting a thread that already is admitted updates its
+ * parameters.
+ *
+ * @param[in,out] thread    thread to admit
+ * @param[in]     runtime   worst case runtime per period
+ * @param[in]     period    period (and relative deadline) of the thread
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p runtime is 0 or larger than @p period
+ * @return  -ENOSPC if admitting the thread would exceed
+ *          @ref SCHED_EDF_UTILIZATION_MAX
+ */
+int sched_edf_admit(thread_t *thread, uint32_t runtime, uint32_t period);
+
+/**
+ * @brief   Remove a thread from the EDF class
+ *
+ * @param[in,out] thread    thread to remove
+ * @param[in]     priority  fixed priority the thread continues with
+ */
+void sched_edf_leave(thread_t *thread, uint8_t priority);
+
+/**
+ * @brief   Set the absolute deadline of the next job of an EDF thread
+ *
+ * Setting the deadline completes the current job: if its deadline already
+ * passed, this counts as a deadline miss.
+ *
+ * @param[in,out] thread    admitted thread
+ * @param[in]     deadline  absolute deadline in @ref SCHED_EDF_TIMERBASE ticks
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p thread is not admitted
+ */
+int thread_set_deadline(thread_t *thread, uint32_t deadline);
+
+/**
+ * @brief   Get the number of deadlines a thread missed
+ *
+ * @param[in]   pid     thread to get the counter of
+ *
+ * @return  number of missed deadlines, 0 for threads not admitted
+ */
+unsigned sched_edf_misses(kernel_pid_t pid);
+
+/**
+ * @brief   Check whether a thread is admitted to the EDF class
+ *
+ * @param[in]   pid     thread to check
+ *
+ * @return  true if @p pid is admitted
+ */
+bool sched_edf_is_admitted(kernel_pid_t pid);
+
+/**
+ * @brief   Add a thread to the runqueue of the EDF priority, in deadline order
+ *
+ * @warning This API is not intended for out of tree users, it is used by
+ *          the scheduler to keep the runqueue sorted.
+ *
+ * @param[in,out] runqueue  runqueue of @ref SCHED_EDF_PRIO
+ * @param[in]     thread    thread to add
+ */
+void sched_edf_runq_push(clist_node_t *runqueue, thread_t *thread);
+
+/**
+ * @brief   Release the EDF reservation of an exiting thread
+ *
+ * @warning This API is not intended for out of tree users, it is called by
+ *          the scheduler with interrupts disabled.
+ *
+ * @param[in]   pid     thread that exits
+ */
+void sched_edf_thread_exit(kernel_pid_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
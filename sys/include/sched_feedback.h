@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sched_feedback Multilevel Feedback Scheduler
+ * @ingroup     sys
+ * @brief       This module provides multilevel feedback scheduling for the
+ *              priorities @ref SCHED_FEEDBACK_LEVEL_FIRST up to
+ *              @ref SCHED_FEEDBACK_LEVEL_LAST.
+ *
+ *              A thread that uses up the quantum of its level is demoted to
+ *              the next (numerically higher) level, threads on the last level
+ *              are scheduled round robin. Every level has its own quantum,
+ *              taken from @ref SCHED_FEEDBACK_QUANTA, so CPU bound threads on
+ *              lower levels get longer and therefore fewer slices.
+ *
+ *              The scheduler is tickless: the quantum timer is only armed
+ *              while there is something to arbitrate, i.e. while the level of
+ *              the running thread holds more than one runnable thread or a
+ *              lower feedback level is not empty. A node with a single
+ *              runnable thread does not wake up for scheduling.
+ *
+ *              Threads with a limited service time (thread_t::service_time)
+ *              are charged with the time they actually ran, measured at every
+ *              run of the scheduler. Once it is used up the thread is
+ *              stopped. Accounting takes constant time per scheduler run.
+ *
+ *              Threads starving on a lower level for longer than
+ *              @ref SCHED_FEEDBACK_AGING since they became runnable are
+ *              promoted one level up again. Aging is checked whenever the
+ *              quantum timer fires, which it keeps doing while threads wait
+ *              on lower levels.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Multilevel Feedback Scheduler
+ *
+ */
+#ifndef SCHED_FEEDBACK_H
+#define SCHED_FEEDBACK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(SCHED_FEEDBACK_TIMERBASE) || defined(DOXYGEN)
+/**
+ * @brief   ztimer to use for the feedback scheduler
+ *
+ * @details Defaults to ZTIMER_MSEC if available else it uses ZTIMER_USEC
+ */
+#if MODULE_ZTIMER_MSEC
+#define SCHED_FEEDBACK_TIMERBASE ZTIMER_MSEC
+#else
+#define SCHED_FEEDBACK_TIMERBASE ZTIMER_USEC
+#endif
+#endif
+
+#if !defined(SCHED_FEEDBACK_LEVEL_FIRST) || defined(DOXYGEN)
+/**
+ * @brief   Highest priority handled by the feedback scheduler
+ *
+ * @details Priority 0 must not be used, parts of this scheduler assume a
+ *          current level of 0 to be uninitialised.
+ */
+#define SCHED_FEEDBACK_LEVEL_FIRST  1
+#endif
+
+#if !defined(SCHED_FEEDBACK_LEVEL_LAST) || defined(DOXYGEN)
+/**
+ * @brief   Lowest priority handled by the feedback scheduler
+ *
+ * @details Threads are never demoted below this level, threads on this level
+ *          are scheduled round robin.
+ */
+#define SCHED_FEEDBACK_LEVEL_LAST   3
+#endif
+
+/**
+ * @brief   Number of feedback levels
+ */
+#define SCHED_FEEDBACK_LEVELS \
+    (SCHED_FEEDBACK_LEVEL_LAST - SCHED_FEEDBACK_LEVEL_FIRST + 1)
+
+#if !defined(CONFIG_SCHED_FEEDBACK_QUANTUM) || defined(DOXYGEN)
+/**
+ * @brief   Quantum of @ref SCHED_FEEDBACK_LEVEL_FIRST in units of
+ *          @ref SCHED_FEEDBACK_TIMERBASE
+ *
+ * @details Defaults to 10ms
+ */
+#if MODULE_ZTIMER_MSEC
+#define CONFIG_SCHED_FEEDBACK_QUANTUM   10
+#else
+#define CONFIG_SCHED_FEEDBACK_QUANTUM   10000
+#endif
+#endif
+
+#if !defined(CONFIG_SCHED_FEEDBACK_QUANTUM_GROWTH) || defined(DOXYGEN)
+/**
+ * @brief   Each level gets a quantum `2^CONFIG_SCHED_FEEDBACK_QUANTUM_GROWTH`
+ *          times as long as the one of the level above
+ *
+ * @details Set to 0 to use @ref CONFIG_SCHED_FEEDBACK_QUANTUM on every level
+ */
+#define CONFIG_SCHED_FEEDBACK_QUANTUM_GROWTH    1
+#endif
+
+#if !defined(SCHED_FEEDBACK_QUANTA) || defined(DOXYGEN)
+/**
+ * @brief   Initializer of the per level quantum table, in units of
+ *          @ref SCHED_FEEDBACK_TIMERBASE
+ *
+ * @details Entry `i` is the quantum of level `SCHED_FEEDBACK_LEVEL_FIRST + i`.
+ *          The table must hold @ref SCHED_FEEDBACK_LEVELS entries, so it has
+ *          to be provided when changing the number of levels. The default
+ *          is derived from @ref CONFIG_SCHED_FEEDBACK_QUANTUM and
+ *          @ref CONFIG_SCHED_FEEDBACK_QUANTUM_GROWTH.
+ */
+#define SCHED_FEEDBACK_QUANTA { \
+        CONFIG_SCHED_FEEDBACK_QUANTUM, \
+        CONFIG_SCHED_FEEDBACK_QUANTUM << CONFIG_SCHED_FEEDBACK_QUANTUM_GROWTH, \
+        CONFIG_SCHED_FEEDBACK_QUANTUM << (2 * CONFIG_SCHED_FEEDBACK_QUANTUM_GROWTH), \
+}
+#endif
+
+#if !defined(SCHED_FEEDBACK_AGING) || defined(DOXYGEN)
+/**
+ * @brief   Time in units of @ref SCHED_FEEDBACK_TIMERBASE a thread may wait
+ *          on a lower feedback level before it gets promoted
+ *
+ * @details Defaults to 1s, set to 0 to disable aging.
+ */
+#if MODULE_ZTIMER_MSEC
+#define SCHED_FEEDBACK_AGING        1000
+#else
+#define SCHED_FEEDBACK_AGING        1000000
+#endif
+#endif
+
+/**
+ * @brief   Get the quantum of a feedback level
+ *
+ * @param[in]   prio    feedback level, must be within
+ *                      [@ref SCHED_FEEDBACK_LEVEL_FIRST,
+ *                      @ref SCHED_FEEDBACK_LEVEL_LAST]
+ *
+ * @return  quantum of @p prio in units of @ref SCHED_FEEDBACK_TIMERBASE
+ */
+uint32_t sched_feedback_quantum(uint8_t prio);
+
+/**
+ *  @brief Initialises the Feedback Scheduler
+ */
+void sched_feedback_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_FEEDBACK_H */
+/** @} */
@@ -32,6 +32,10 @@
 #ifndef SCHED_ROUND_ROBIN_H
 #define SCHED_ROUND_ROBIN_H
 
+#if MODULE_SCHED_EDF
+#include "sched_edf.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -70,9 +74,14 @@ extern "C" {
  *          Threads with that priority may not be programmed
  *          with the possibility of being scheduled in mind.
  *          Parts of this scheduler assume 0 current_rr_priority is uninitialised.
+ *          The priority of @ref sched_edf is masked as well.
  */
+#if MODULE_SCHED_EDF
+#define SCHED_RR_MASK ((1 << 0) | (1 << SCHED_EDF_PRIO))
+#else
 #define SCHED_RR_MASK (1 << 0)
 #endif
+#endif
 
 /**
  *  @brief Initialises the Round Robin Scheduler
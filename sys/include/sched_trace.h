@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sched_trace Scheduler Tracing
+ * @ingroup     sys
+ * @brief       Records every context switch into a ring buffer
+ *
+ *              For each thread switch the scheduler stores a compact record
+ *              (@ref sched_trace_rec_t) holding a microsecond timestamp, the
+ *              threads switched from and to, the state the previous thread
+ *              left the CPU in and the priority (i.e. the runqueue or feedback
+ *              level) of the next thread.
+ *
+ *              Records are written by the scheduler only, with interrupts
+ *              disabled, so writing does not need any further locking. Once
+ *              the buffer is full the oldest records are overwritten. Reading
+ *              is lock free: @ref sched_trace_dump() copies the records one by
+ *              one and drops those that got overwritten while copying.
+ *
+ *              The trace is exported in a binary format (see
+ *              @ref sched_trace_hdr_t), either through a write callback or,
+ *              on the native board, directly into a file. The host tool in
+ *              `dist/tools/sched_trace` converts it into the Chrome trace
+ *              event JSON format understood by Perfetto and chrome://tracing.
+ *              The `schedtrace` shell command controls the tracer.
+ *
+ *              Timestamps are taken from ZTIMER_USEC and wrap after about
+ *              71 minutes, the host tool unwraps them.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Scheduler Tracing
+ *
+ */
+#ifndef SCHED_TRACE_H
+#define SCHED_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(CONFIG_SCHED_TRACE_BUFSIZE) || defined(DOXYGEN)
+/**
+ * @brief   Number of records in the trace buffer, must be a power of 2
+ */
+#define CONFIG_SCHED_TRACE_BUFSIZE      256
+#endif
+
+/**
+ * @brief   Magic number starting a binary trace ("RSTR")
+ */
+#define SCHED_TRACE_MAGIC               0x52545352UL
+
+/**
+ * @brief   Version of the binary trace format
+ */
+#define SCHED_TRACE_VERSION             1
+
+/**
+ * @brief   Value of sched_trace_rec_t::reason if no thread ran before the
+ *          switch (the CPU was idle without an idle thread)
+ */
+#define SCHED_TRACE_REASON_IDLE         0xff
+
+/**
+ * @brief   A single context switch record
+ *
+ * All fields are stored in the byte order of the traced CPU.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t time;          /**< time of the switch in microseconds */
+    int16_t prev;           /**< pid of the previous thread, or
+                                 KERNEL_PID_UNDEF if the CPU was idle */
+    int16_t next;           /**< pid of the next thread */
+    uint8_t reason;         /**< thread_status_t the previous thread had
+                                 when it was switched out (STATUS_RUNNING:
+                                 it was preempted or yielded), or
+                                 @ref SCHED_TRACE_REASON_IDLE */
+    uint8_t level;          /**< priority of the next thread */
+} sched_trace_rec_t;
+
+/**
+ * @brief   Header of a binary trace
+ *
+ * The header is followed by @ref sched_trace_hdr_t::names thread name
+ * entries, each made of the pid (int16_t), the length of the name (uint8_t)
+ * and the name without terminating zero. The length is 0 if thread names are
+ * not available. The records follow up to the end of the trace, oldest first.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t magic;         /**< @ref SCHED_TRACE_MAGIC, also tells the
+                                 byte order */
+    uint8_t version;        /**< @ref SCHED_TRACE_VERSION */
+    uint8_t rec_size;       /**< sizeof(sched_trace_rec_t) */
+    uint16_t names;         /**< number of thread name entries */
+    uint32_t ticks_per_sec; /**< unit of sched_trace_rec_t::time */
+    uint32_t lost;          /**< number of records overwritten before
+                                 they could be dumped */
+} sched_trace_hdr_t;
+
+/**
+ * @brief   Write callback used to export a trace
+ *
+ * @param[in]   arg     argument passed to @ref sched_trace_dump()
+ * @param[in]   data    data to write
+ * @param[in]   len     number of bytes in @p data
+ *
+ * @return  @p len on success, a negative errno value otherwise
+ */
+typedef ssize_t (*sched_trace_write_t)(void *arg, const void *data, size_t len);
+
+/**
+ * @brief   Start or stop recording
+ *
+ * Recording starts on its own once the module is initialized. Stopping it
+ * before dumping makes sure the dump is not missing records that got
+ * overwritten while the trace was exported.
+ *
+ * @param[in]   on      true to record switches
+ */
+void sched_trace_enable(bool on);
+
+/**
+ * @brief   Drop all records
+ */
+void sched_trace_reset(void);
+
+/**
+ * @brief   Get the number of switches recorded since the last reset
+ *
+ * @return  number of records written, including those already overwritten
+ */
+uint32_t sched_trace_count(void);
+
+/**
+ * @brief   Export the trace in the binary format
+ *
+ * @param[in]   write   function called with consecutive chunks of the trace
+ * @param[in]   arg     argument passed to @p write
+ *
+ * @return  number of records exported
+ * @return  the negative return value of @p write if it failed
+ */
+int sched_trace_dump(sched_trace_write_t write, void *arg);
+
+#if defined(CPU_NATIVE) || defined(DOXYGEN)
+/**
+ * @brief   Export the trace into a file on the host
+ *
+ * @note    Only available on the native board
+ *
+ * @param[in]   path    file to create, an existing file gets truncated
+ *
+ * @return  number of records exported
+ * @return  -errno if the file could not be written
+ */
+int sched_trace_dump_file(const char *path);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_TRACE_H */
+/** @} */
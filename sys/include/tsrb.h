@@ -12,6 +12,29 @@
  * @brief       Thread-safe ringbuffer implementation
  * @{
  *
+ * All operations are safe to use from any thread or interrupt context. They
+ * copy the data in at most two contiguous spans with interrupts disabled.
+ *
+ * With the module `tsrb_spsc`, interrupts are no longer disabled. Instead, the
+ * read and write counters are accessed using @ref sys_atomic_utils. This is
+ * only safe as long as every ringbuffer of the application has at most one
+ * producer and one consumer at a time, e.g. an ISR filling the ringbuffer and
+ * a single thread draining it:
+ *
+ * - tsrb_add(), tsrb_add_one(), tsrb_add_span() and tsrb_add_commit() must
+ *   only be called by the producer
+ * - tsrb_get(), tsrb_get_one(), tsrb_peek(), tsrb_peek_one(), tsrb_drop(),
+ *   tsrb_get_span(), tsrb_get_commit() and tsrb_clear() must only be called
+ *   by the consumer
+ * - tsrb_empty(), tsrb_avail(), tsrb_full() and tsrb_free() can be called by
+ *   either
+ *
+ * Data can also be accessed in place: tsrb_add_span() returns the contiguous
+ * free space to fill (e.g. by DMA), tsrb_get_span() the contiguous data to
+ * parse. The data is only added or removed once tsrb_add_commit() or
+ * tsrb_get_commit() is called. In between, no other context may add or
+ * remove data on the same side of the ringbuffer.
+ *
  * @attention   Buffer size must be a power of two!
  *
  * @file
@@ -24,10 +47,15 @@
 #define TSRB_H
 
 #include <assert.h>
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #include "irq.h"
+#include "kernel_defines.h"
+#if IS_USED(MODULE_TSRB_SPSC)
+#include "atomic_utils.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,15 +95,78 @@ static inline void tsrb_init(tsrb_t *rb, uint8_t *buffer, unsigned bufsize)
     rb->writes = 0;
 }
 
+#if IS_USED(MODULE_TSRB_SPSC) || defined(DOXYGEN)
+/**
+ * @brief       Atomically load a counter of a tsrb (used internally)
+ *
+ * @internal
+ *
+ * @param[in]   var counter to load
+ * @return      value of @p var
+ */
+static inline unsigned _tsrb_load(const unsigned *var)
+{
+#if UINT_MAX == UINT16_MAX
+    return atomic_load_u16((const volatile uint16_t *)var);
+#else
+    return atomic_load_u32((const volatile uint32_t *)var);
+#endif
+}
+
+/**
+ * @brief       Atomically store a counter of a tsrb (used internally)
+ *
+ * @internal
+ *
+ * @param[out]  var counter to store
+ * @param[in]   val value to store
+ */
+static inline void _tsrb_store(unsigned *var, unsigned val)
+{
+#if UINT_MAX == UINT16_MAX
+    atomic_store_u16((volatile uint16_t *)var, val);
+#else
+    atomic_store_u32((volatile uint32_t *)var, val);
+#endif
+}
+#endif
+
+/**
+ * @brief       Get a snapshot of the counters of a tsrb (used internally)
+ *
+ * @internal
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  reads   total number of reads
+ * @param[out]  writes  total number of writes
+ */
+static inline void _tsrb_counters(const tsrb_t *rb, unsigned *reads,
+                                  unsigned *writes)
+{
+#if IS_USED(MODULE_TSRB_SPSC)
+    *reads = _tsrb_load(&rb->reads);
+    *writes = _tsrb_load(&rb->writes);
+#else
+    unsigned irq_state = irq_disable();
+    *reads = rb->reads;
+    *writes = rb->writes;
+    irq_restore(irq_state);
+#endif
+}
+
 /**
  * @brief        Clear a tsrb.
  * @param[out]   rb Ringbuffer to operate on
  */
 static inline void tsrb_clear(tsrb_t *rb)
 {
+#if IS_USED(MODULE_TSRB_SPSC)
+    _tsrb_store(&rb->reads, _tsrb_load(&rb->writes));
+#else
     unsigned irq_state = irq_disable();
     rb->reads = rb->writes;
     irq_restore(irq_state);
+#endif
 }
 
 /**
@@ -86,10 +177,9 @@ static inline void tsrb_clear(tsrb_t *rb)
  */
 static inline int tsrb_empty(const tsrb_t *rb)
 {
-    unsigned irq_state = irq_disable();
-    int retval = (rb->reads == rb->writes);
-    irq_restore(irq_state);
-    return retval;
+    unsigned reads, writes;
+    _tsrb_counters(rb, &reads, &writes);
+    return (reads == writes);
 }
 
 /**
@@ -99,10 +189,9 @@ static inline int tsrb_empty(const tsrb_t *rb)
  */
 static inline unsigned int tsrb_avail(const tsrb_t *rb)
 {
-    unsigned irq_state = irq_disable();
-    int retval = (rb->writes - rb->reads);
-    irq_restore(irq_state);
-    return retval;
+    unsigned reads, writes;
+    _tsrb_counters(rb, &reads, &writes);
+    return (writes - reads);
 }
 
 /**
@@ -113,10 +202,9 @@ static inline unsigned int tsrb_avail(const tsrb_t *rb)
  */
 static inline int tsrb_full(const tsrb_t *rb)
 {
-    unsigned irq_state = irq_disable();
-    int retval = (rb->writes - rb->reads) == rb->size;
-    irq_restore(irq_state);
-    return retval;
+    unsigned reads, writes;
+    _tsrb_counters(rb, &reads, &writes);
+    return (writes - reads) == rb->size;
 }
 
 /**
@@ -126,10 +214,9 @@ static inline int tsrb_full(const tsrb_t *rb)
  */
 static inline unsigned int tsrb_free(const tsrb_t *rb)
 {
-    unsigned irq_state = irq_disable();
-    int retval = (rb->size - rb->writes + rb->reads);
-    irq_restore(irq_state);
-    return retval;
+    unsigned reads, writes;
+    _tsrb_counters(rb, &reads, &writes);
+    return (rb->size - writes + reads);
 }
 
 /**
@@ -192,6 +279,51 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the contiguous data at the start of the ringbuffer,
+ *              without removing it
+ *
+ * The data may be split in two by the end of the buffer, call again after
+ * tsrb_get_commit() to get the second part.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the data
+ * @return      nr of bytes that can be read from @p data, 0 if empty
+ */
+unsigned tsrb_get_span(tsrb_t *rb, const uint8_t **data);
+
+/**
+ * @brief       Remove bytes read from the span returned by tsrb_get_span()
+ *
+ * @pre         @p n is not larger than the span
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes read
+ */
+void tsrb_get_commit(tsrb_t *rb, unsigned n);
+
+/**
+ * @brief       Get the contiguous free space at the end of the ringbuffer
+ *
+ * The free space may be split in two by the end of the buffer, call again
+ * after tsrb_add_commit() to get the second part.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    start of the free space
+ * @return      nr of bytes that can be written to @p data, 0 if full
+ */
+unsigned tsrb_add_span(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Add bytes written to the span returned by tsrb_add_span()
+ *
+ * @pre         @p n is not larger than the span
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written
+ */
+void tsrb_add_commit(tsrb_t *rb, unsigned n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -158,6 +158,15 @@
  * performance for any reasonable amount of active timers.
  *
  *
+ * ## Timer coalescing
+ *
+ * With the `ztimer_slack` module, timers can be set with ztimer_set_slack(),
+ * telling the clock how late they may fire. Instead of the first target, the
+ * clock is then set to the earliest target plus slack of all timers, and every
+ * timer expiring until then is handled in the same ISR. Timers set with plain
+ * ztimer_set() have no slack and always fire on time.
+ *
+ *
  * ## Clock extension
  *
  * The API always allows setting full 32bit relative offsets for every clock.
@@ -171,10 +180,15 @@
  * interval fits into max_value.
  * If extension is enabled for a clock, ztimer_now() uses interval
  * checkpointing, storing the current time and corresponding clock tick value on
- * each call and using that information to calculate the current time.
- * This ensures correct ztimer_now() values if ztimer_now() is called at least
- * once every "max_value" ticks. This is ensured by scheduling intermediate
- * callbacks every (max_value / 2) ticks (even if no timeout is configured).
+ * each timer interrupt and using that information to calculate the current
+ * time. This ensures correct ztimer_now() values as long as a checkpoint is
+ * stored at least once every "max_value" ticks. This is ensured by scheduling
+ * intermediate callbacks every (max_value / 2) ticks (even if no timeout is
+ * configured).
+ * ztimer_now() itself only reads the checkpoint and does not disable
+ * interrupts, it retries if a checkpoint is stored while it reads. Only if
+ * the checkpoint is more than (max_value / 2) ticks old, ztimer_now() stores
+ * a new one.
  *
  *
  * ## Reliability
@@ -288,6 +302,16 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+/**
+ * @brief ztimer_wheel_t forward declaration
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+
+/**
+ * @brief ztimer_overhead_latency_t forward declaration
+ */
+typedef struct ztimer_overhead_latency ztimer_overhead_latency_t;
+
 /**
  * @brief Type of callbacks in @ref ztimer_t "timers"
  */
@@ -299,6 +323,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **pprev;      /**< link pointing to this timer while it is
+                                     stored in a @ref sys_ztimer_wheel */
+#endif
 };
 
 /**
@@ -333,6 +361,10 @@ typedef struct {
     ztimer_base_t base;             /**< clock list entry */
     ztimer_callback_t callback;     /**< timer callback function pointer */
     void *arg;                      /**< timer callback argument */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t slack;                 /**< ticks the timer may still fire
+                                         late, see ztimer_set_slack() */
+#endif
 } ztimer_t;
 
 /**
@@ -396,13 +428,28 @@ struct ztimer_clock {
 #if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64 || DOXYGEN
     /* values used for checkpointed intervals and 32bit extension */
     uint32_t max_value;             /**< maximum relative timer value       */
-    uint32_t lower_last;            /**< timer value at last now() call     */
-    ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
+    uint32_t lower_last;            /**< timer value at last checkpoint     */
+    ztimer_now_t checkpoint;        /**< cumulated time at last checkpoint  */
+    uint16_t epoch;                 /**< incremented on every checkpoint    */
+#endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timer wheel holding the timers
+                                         instead of the list, if not NULL   */
+#endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t coalesced;             /**< number of timers that expired in the
+                                         same ISR as an earlier timer       */
+#endif
+#if MODULE_ZTIMER_OVERHEAD || DOXYGEN
+    ztimer_overhead_latency_t *latency; /**< ISR latency histogram, see
+                                             ztimer_overhead_latency_attach() */
 #endif
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND || DOXYGEN
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+    bool in_handler;                /**< ztimer_handler() is running callbacks,
+                                         the clock is armed once they are done */
 };
 
 /**
@@ -473,6 +520,41 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to fire late
+ *
+ * Same as @ref ztimer_set(), but @p timer may fire up to @p slack ticks after
+ * its target. The clock uses the slack to handle timers expiring close to
+ * each other in a single ISR, which saves wakeups and interrupt load. Timers
+ * set with ztimer_set() have no slack.
+ *
+ * The number of timers that expired in the same ISR as an earlier timer is
+ * counted in ztimer_clock_t::coalesced.
+ *
+ * @note    Only available with the `ztimer_slack` module, otherwise the slack
+ *          is ignored. Clocks using a @ref sys_ztimer_wheel ignore the slack,
+ *          too.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       ticks @p timer may fire after its target
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ *         (`now() + @p val = absolute trigger time`).
+ */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack);
+#else
+static inline uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                                        uint32_t val, uint32_t slack)
+{
+    (void)slack;
+    return ztimer_set(clock, timer, val);
+}
+#endif
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -547,6 +629,8 @@ int ztimer_msg_receive_timeout(ztimer_clock_t *clock, msg_t *msg,
 /**
  * @brief ztimer_now() for extending timers
  *
+ * Lock-free unless the clock's checkpoint has to be updated.
+ *
  * @internal
  *
  * @param[in]   clock          ztimer clock to operate on
@@ -18,6 +18,11 @@
  * inversions, avoiding integer divisions. frac trades accuracy for speed.
  * Please see the documentation of frac for more details.
  *
+ * The conversions from 32768 Hz and from 1 MHz to 1 kHz, which ZTIMER_MSEC
+ * commonly uses, are precomputed unless @ref CONFIG_ZTIMER_CONVERT_FRAC_CONST
+ * is 0. Clocks using them skip frac_init() and convert with constant shifts
+ * and multiplications, yielding the same results.
+ *
  * @{
  * @file
  * @brief   ztimer_convert_frac interface definitions
@@ -38,6 +43,13 @@
 extern "C" {
 #endif
 
+#if !defined(CONFIG_ZTIMER_CONVERT_FRAC_CONST) || defined(DOXYGEN)
+/**
+ * @brief   Use precomputed conversions for common frequencies
+ */
+#define CONFIG_ZTIMER_CONVERT_FRAC_CONST    1
+#endif
+
 /**
  * @brief   ztimer_convert_frac frequency conversion layer class
  */
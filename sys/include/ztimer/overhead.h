@@ -13,6 +13,11 @@
  * @ingroup     sys_ztimer
  * @brief       ztimer overhead measurement functionality
  *
+ * Besides measuring the overhead of ztimer_set() and ztimer_sleep(), this
+ * module can record a histogram of the ISR latency of a clock, i.e. of the
+ * ticks between the time a clock was armed for and the time ztimer_handler()
+ * processes the expired timers, see ztimer_overhead_latency_attach().
+ *
  * @{
  *
  * @file
@@ -24,12 +29,33 @@
 #ifndef ZTIMER_OVERHEAD_H
 #define ZTIMER_OVERHEAD_H
 
+#include <stdint.h>
+
 #include "ztimer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of an ISR latency histogram, 2 to 33
+ */
+#ifndef CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS
+#define CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS  (12U)
+#endif
+
+/**
+ * @brief   ISR latency histogram
+ *
+ * Bucket 0 counts ISRs without latency, bucket `n` counts latencies of
+ * `2^(n-1)` to `2^n - 1` ticks. The last bucket also counts all larger
+ * latencies.
+ */
+struct ztimer_overhead_latency {
+    /** number of ISRs per bucket */
+    uint32_t count[CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS];
+};
+
 /**
  * @brief   Measure overhead for ztimer_set()
  *
@@ -54,5 +80,33 @@ int32_t ztimer_overhead_set(ztimer_clock_t *clock, uint32_t base);
  */
 int32_t ztimer_overhead_sleep(ztimer_clock_t *clock, uint32_t base);
 
+/**
+ * @brief   Record the ISR latency of a clock
+ *
+ * @p hist is cleared. Every ISR of @p clock that processes expired timers is
+ * counted in it from now on.
+ *
+ * @param[in]   clock   ztimer clock to operate on
+ * @param[out]  hist    histogram to record to, NULL to stop recording
+ */
+void ztimer_overhead_latency_attach(ztimer_clock_t *clock,
+                                    ztimer_overhead_latency_t *hist);
+
+/**
+ * @brief   Count a latency in a histogram
+ *
+ * @param[in,out]   hist    histogram to count in
+ * @param[in]       ticks   latency in ticks
+ */
+void ztimer_overhead_latency_add(ztimer_overhead_latency_t *hist,
+                                 uint32_t ticks);
+
+/**
+ * @brief   Print a histogram
+ *
+ * @param[in]   hist    histogram to print
+ */
+void ztimer_overhead_latency_print(const ztimer_overhead_latency_t *hist);
+
 #endif /* ZTIMER_OVERHEAD_H */
 /** @} */
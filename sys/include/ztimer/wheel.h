@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_wheel  ztimer hierarchical timer wheel
+ * @ingroup     sys_ztimer
+ * @brief       O(1) timer storage for clocks with many timers
+ *
+ * By default a ztimer clock keeps its timers in a sorted list, so setting or
+ * removing a timer takes time linear in the number of timers set. With the
+ * module `ztimer_wheel`, a clock can instead store its timers in a
+ * hierarchical timer wheel, where setting and removing a timer takes constant
+ * time. The ztimer API does not change.
+ *
+ * The wheel has @ref ZTIMER_WHEEL_LEVELS levels of @ref ZTIMER_WHEEL_SLOTS
+ * slots each. A slot of level `n` spans `ZTIMER_WHEEL_SLOTS^n` ticks, level 0
+ * holds the timers that expire within the current span of level 1 sorted by
+ * their exact target. A timer further away is stored in the slot of the
+ * lowest level that spans its target, and is moved down (cascaded) once the
+ * clock reaches the start of that slot. Every timer is cascaded at most
+ * `ZTIMER_WHEEL_LEVELS - 1` times.
+ *
+ * The clock is armed for the next timer in level 0 or, if level 0 is empty,
+ * for the start of the next occupied slot of a higher level. Thus clocks with
+ * a wheel may wake up before the first timer expires, up to once per level.
+ *
+ * With `ztimer_wheel`, ZTIMER_USEC, ZTIMER_MSEC and ZTIMER_SEC use a wheel.
+ * Other clocks can be switched over with ztimer_wheel_attach(). Each wheel
+ * takes `ZTIMER_WHEEL_LEVELS * (ZTIMER_WHEEL_SLOTS + 1) + 1` words of RAM (548
+ * bytes with the default configuration on 32 bit platforms).
+ *
+ * As with the sorted list, ztimer_t objects need not be initialized before
+ * they are set or removed: whether a timer is set is decided by following
+ * links stored in the wheel only. This takes constant time for zeroed timers,
+ * timers that were removed or expired and timers set last in their slot.
+ * Removing or setting another timer that is set walks the timers sharing its
+ * slot.
+ *
+ * @note    Timers expiring at the same tick fire in no particular order.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timer wheel API
+ *
+ */
+
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(CONFIG_ZTIMER_WHEEL_BITS) || defined(DOXYGEN)
+/**
+ * @brief   log2 of the number of slots per level, 1 to 5
+ */
+#define CONFIG_ZTIMER_WHEEL_BITS        4
+#endif
+
+/**
+ * @brief   Number of slots per level
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << CONFIG_ZTIMER_WHEEL_BITS)
+
+/**
+ * @brief   Number of levels needed to cover 32 bit offsets
+ */
+#define ZTIMER_WHEEL_LEVELS     ((32 + CONFIG_ZTIMER_WHEEL_BITS - 1) / \
+                                 CONFIG_ZTIMER_WHEEL_BITS)
+
+/**
+ * @brief   Hierarchical timer wheel
+ */
+struct ztimer_wheel {
+    /** lists of timers per slot */
+    ztimer_base_t *slots[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+    uint32_t pending[ZTIMER_WHEEL_LEVELS];  /**< occupied slots per level */
+    uint32_t base;                          /**< time the wheel is at */
+};
+
+/**
+ * @brief   Store the timers of a clock in a timer wheel
+ *
+ * Timers already set on @p clock are moved into the wheel.
+ *
+ * @param[in]   clock   clock to use the wheel for
+ * @param[out]  wheel   wheel to use, must stay valid as long as the clock is
+ *                      used
+ */
+void ztimer_wheel_attach(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+
+/**
+ * @name    Wheel operations used by the ztimer core
+ *
+ * All times are absolute clock values, all functions must be called with
+ * interrupts disabled.
+ *
+ * @internal
+ * @{
+ */
+
+/**
+ * @brief   Initialize an empty wheel
+ *
+ * @param[out]  wheel   wheel to initialize
+ * @param[in]   now     current time
+ */
+void ztimer_wheel_init(ztimer_wheel_t *wheel, uint32_t now);
+
+/**
+ * @brief   Check whether a wheel holds no timers
+ *
+ * @param[in]   wheel   wheel to check
+ *
+ * @return  true if @p wheel is empty
+ */
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Check whether a timer is stored in a wheel
+ *
+ * Only follows links stored in @p wheel, so @p entry may be uninitialized.
+ *
+ * @param[in]   wheel   wheel to check
+ * @param[in]   entry   timer to check
+ *
+ * @return  true if @p entry is stored in @p wheel
+ */
+bool ztimer_wheel_is_set(const ztimer_wheel_t *wheel,
+                         const ztimer_base_t *entry);
+
+/**
+ * @brief   Add a timer to a wheel
+ *
+ * @pre     @p entry is not stored in a wheel, @p target is not before the
+ *          time the wheel is at
+ *
+ * @param[in]   wheel   wheel to add the timer to
+ * @param[in]   entry   timer to add
+ * @param[in]   target  time the timer expires at
+ *
+ * @return  true if the next event of the wheel moved
+ */
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                      uint32_t target);
+
+/**
+ * @brief   Remove a timer from a wheel
+ *
+ * @pre     @p entry is stored in @p wheel
+ *
+ * @param[in]   wheel   wheel to remove the timer from
+ * @param[in]   entry   timer to remove
+ */
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry);
+
+/**
+ * @brief   Get the time of the next event of a wheel
+ *
+ * The next event is either the expiry of the first timer or the time a slot
+ * has to be cascaded.
+ *
+ * @param[in]   wheel   wheel to check
+ * @param[out]  next    time of the next event
+ *
+ * @return  false if @p wheel is empty
+ */
+bool ztimer_wheel_next(const ztimer_wheel_t *wheel, uint32_t *next);
+
+/**
+ * @brief   Advance a wheel
+ *
+ * Advances the wheel to @p now, cascading the slots reached on the way, but
+ * stops at the first time timers expire at.
+ *
+ * @param[in]   wheel   wheel to advance
+ * @param[in]   now     current time
+ */
+void ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now);
+
+/**
+ * @brief   Take the next timer expiring at the time the wheel is at
+ *
+ * @param[in]   wheel   wheel to take the timer from
+ *
+ * @return  the timer, removed from the wheel
+ * @return  NULL if no timer expires at the time the wheel is at
+ */
+ztimer_base_t *ztimer_wheel_pop(ztimer_wheel_t *wheel);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
@@ -112,6 +112,7 @@ struct ztimer64_clock {
     ztimer_clock_t *base_clock;     /**< 32bit clock backend                */
     ztimer_t base_timer;            /**< 32bit backend timer                */
     uint64_t checkpoint;            /**< lower timer checkpoint offset      */
+    uint16_t epoch;                 /**< incremented on every checkpoint    */
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
     uint16_t adjust_sleep;          /**< will be subtracted on every sleep(),
                                          in addition to adjust_set          */
@@ -55,3 +55,20 @@ int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
     }
     return res;
 }
+
+void isrpipe_write_commit(isrpipe_t *isrpipe, size_t n)
+{
+    tsrb_add_commit(&isrpipe->tsrb, n);
+
+    mutex_unlock(&isrpipe->mutex);
+}
+
+size_t isrpipe_read_span(isrpipe_t *isrpipe, const uint8_t **data)
+{
+    size_t res;
+
+    while (!(res = tsrb_get_span(&isrpipe->tsrb, data))) {
+        mutex_lock(&isrpipe->mutex);
+    }
+    return res;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @ingroup     sys_msg_payload
+ * @{
+ *
+ * @file
+ * @brief       Zero-copy message payloads implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "msg_payload.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+void msg_payload_pool_init(msg_payload_pool_t *pool, void *buf, uint16_t size,
+                           size_t num)
+{
+    assert(pool && buf && num);
+
+    pool->size = size;
+    memarray_init(&pool->mem, buf, MSG_PAYLOAD_ELEM_SIZE(size), num);
+}
+
+size_t msg_payload_pool_available(msg_payload_pool_t *pool)
+{
+    unsigned state = irq_disable();
+    size_t res = memarray_available(&pool->mem);
+
+    irq_restore(state);
+    return res;
+}
+
+msg_payload_t *msg_payload_alloc(msg_payload_pool_t *pool, size_t len)
+{
+    if (len > pool->size) {
+        return NULL;
+    }
+
+    unsigned state = irq_disable();
+    msg_payload_t *payload = memarray_alloc(&pool->mem);
+
+    irq_restore(state);
+    if (!payload) {
+        DEBUG("msg_payload: pool %p exhausted\n", (void *)pool);
+        return NULL;
+    }
+    payload->pool = pool;
+    payload->len = len;
+    payload->refs = 1;
+    return payload;
+}
+
+void msg_payload_hold(msg_payload_t *payload)
+{
+    unsigned state = irq_disable();
+
+    assert(payload->refs && (payload->refs < UINT8_MAX));
+    payload->refs++;
+    irq_restore(state);
+}
+
+void msg_payload_release(msg_payload_t *payload)
+{
+    if (!payload) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+
+    assert(payload->refs);
+    if (--payload->refs == 0) {
+        memarray_free(&payload->pool->mem, payload);
+    }
+    irq_restore(state);
+}
+
+int msg_payload_send(msg_t *m, uint16_t type, msg_payload_t *payload,
+                     kernel_pid_t target_pid)
+{
+    m->type = type;
+    m->content.ptr = payload;
+
+    int res = msg_send(m, target_pid);
+    if (res <= 0) {
+        DEBUG("msg_payload: dropping message to %" PRIkernel_pid "\n",
+              target_pid);
+        msg_payload_release(payload);
+    }
+    return res;
+}
+
+int msg_payload_try_send(msg_t *m, uint16_t type, msg_payload_t *payload,
+                         kernel_pid_t target_pid)
+{
+    m->type = type;
+    m->content.ptr = payload;
+
+    int res = msg_try_send(m, target_pid);
+    if (res <= 0) {
+        DEBUG("msg_payload: dropping message to %" PRIkernel_pid "\n",
+              target_pid);
+        msg_payload_release(payload);
+    }
+    return res;
+}
@@ -133,6 +133,7 @@ static const char *_netopt_strmap[] = {
     [NETOPT_BATMON]                = "NETOPT_BATMON",
     [NETOPT_L2_GROUP]              = "NETOPT_L2_GROUP",
     [NETOPT_L2_GROUP_LEAVE]        = "NETOPT_L2_GROUP_LEAVE",
+    [NETOPT_RX_ONE_PASS]           = "NETOPT_RX_ONE_PASS",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
@@ -82,6 +82,29 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+static int _snd_rcv_direct(gnrc_netreg_entry_direct_t *direct, uint16_t type,
+                           gnrc_pktsnip_t *pkt)
+{
+    /* sending would run the lower layers on the stack of the caller */
+    if ((type == GNRC_NETAPI_MSG_TYPE_RCV) && mutex_trylock(&direct->lock)) {
+        /* Packets taken or queued by the module must not be overtaken. The
+         * module's thread only waits in msg_receive() with an empty queue
+         * and the lock released, but it may already have received a message
+         * without having taken the lock yet. */
+        bool handled = (thread_getstatus(direct->pid) == STATUS_RECEIVE_BLOCKED) &&
+                       direct->recv(pkt);
+
+        mutex_unlock(&direct->lock);
+        if (handled) {
+            return 1;
+        }
+    }
+    /* module is busy, queue packet for its thread */
+    return _gnrc_netapi_send_recv(direct->pid, pkt, type);
+}
+#endif
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -95,10 +118,15 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH) || \
+    defined(MODULE_GNRC_NETAPI_DIRECT)
             uint32_t status = 0;
             switch (sendto->type) {
                 case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETAPI_BATCH
+                case GNRC_NETREG_TYPE_BATCH:
+#endif
                     if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
                                                cmd) < 1) {
                         /* unable to dispatch packet */
@@ -113,6 +141,14 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                     }
                     break;
 #endif
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+                case GNRC_NETREG_TYPE_DIRECT:
+                    if (_snd_rcv_direct(sendto->target.direct, cmd, pkt) < 1) {
+                        /* unable to dispatch packet */
+                        status = EIO;
+                    }
+                    break;
+#endif
 #ifdef MODULE_GNRC_NETAPI_CALLBACKS
                 case GNRC_NETREG_TYPE_CB:
                     sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
@@ -140,3 +176,93 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 
     return numof;
 }
+
+#ifdef MODULE_GNRC_NETAPI_BATCH
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *pkts)
+{
+    gnrc_netreg_acquire_shared();
+
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof == 1) {
+        gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+
+        if (sendto->type == GNRC_NETREG_TYPE_BATCH) {
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkts,
+                                       GNRC_NETAPI_MSG_TYPE_RCV_BATCH) < 1) {
+                /* unable to dispatch chain */
+                while (pkts) {
+                    gnrc_pktsnip_t *next = pkts->next_pkt;
+                    gnrc_pktbuf_release_error(pkts, EIO);
+                    pkts = next;
+                }
+            }
+            gnrc_netreg_release_shared();
+            return numof;
+        }
+    }
+
+    gnrc_netreg_release_shared();
+
+    if (numof == 0) {
+        return 0;
+    }
+    while (pkts) {
+        /* the receiver may already use next_pkt once it got the packet */
+        gnrc_pktsnip_t *next = pkts->next_pkt;
+        if (gnrc_netapi_dispatch_receive(type, demux_ctx, pkts) == 0) {
+            /* subscriber unregistered in the meantime */
+            gnrc_pktbuf_release(pkts);
+        }
+        pkts = next;
+    }
+    return numof;
+}
+
+void gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch)
+{
+    gnrc_pktsnip_t *pkts = batch->head;
+
+    if (pkts == NULL) {
+        return;
+    }
+    DEBUG("gnrc_netapi: passing on chain of %u packets\n",
+          (unsigned)batch->numof);
+    batch->head = NULL;
+    batch->tail = NULL;
+    batch->numof = 0;
+    if (gnrc_netapi_dispatch_receive_batch(batch->type, batch->demux_ctx,
+                                           pkts) == 0) {
+        DEBUG("gnrc_netapi: unable to forward chain of type %i\n",
+              batch->type);
+        while (pkts) {
+            gnrc_pktsnip_t *next = pkts->next_pkt;
+            gnrc_pktbuf_release(pkts);
+            pkts = next;
+        }
+    }
+}
+
+void gnrc_netapi_batch_add(gnrc_netapi_batch_t *batch, gnrc_nettype_t type,
+                           uint32_t demux_ctx, gnrc_pktsnip_t *pkt)
+{
+    if ((batch->head != NULL) &&
+        ((batch->type != type) || (batch->demux_ctx != demux_ctx))) {
+        gnrc_netapi_batch_flush(batch);
+    }
+    pkt->next_pkt = NULL;
+    if (batch->head == NULL) {
+        batch->head = pkt;
+        batch->type = type;
+        batch->demux_ctx = demux_ctx;
+    }
+    else {
+        batch->tail->next_pkt = pkt;
+    }
+    batch->tail = pkt;
+    if (++batch->numof >= CONFIG_GNRC_NETAPI_BATCH_SIZE) {
+        gnrc_netapi_batch_flush(batch);
+    }
+}
+#endif /* MODULE_GNRC_NETAPI_BATCH */
@@ -18,6 +18,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 #include "net/gnrc.h"
 #include "net/gnrc/netif/ethernet.h"
@@ -175,7 +176,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     netdev_t *dev = netif->dev;
     gnrc_pktsnip_t *pkt = NULL;
     netdev_eth_rx_info_t rx_info = { .flags = 0 };
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    int bytes_expected = gnrc_netif_netdev_rx_len(netif, ETHERNET_FRAME_LEN);
 
     if (bytes_expected > 0) {
         pkt = gnrc_pktbuf_add(NULL, NULL,
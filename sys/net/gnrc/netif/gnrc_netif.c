@@ -1482,11 +1482,16 @@ static void _init_from_device(gnrc_netif_t *netif)
     int res;
     netdev_t *dev = netif->dev;
     uint16_t tmp;
+    netopt_enable_t enable = NETOPT_DISABLE;
 
     res = dev->driver->get(dev, NETOPT_DEVICE_TYPE, &tmp, sizeof(tmp));
     (void)res;
     assert(res == sizeof(tmp));
     netif->device_type = (uint8_t)tmp;
+    res = dev->driver->get(dev, NETOPT_RX_ONE_PASS, &enable, sizeof(enable));
+    if ((res == sizeof(enable)) && (enable == NETOPT_ENABLE)) {
+        netif->flags |= GNRC_NETIF_FLAGS_RX_ONE_PASS;
+    }
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
 }
@@ -1732,6 +1737,10 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
                 evp->handler(evp);
             }
         }
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+        /* pass the packets received while handling the events on in one go */
+        gnrc_netapi_batch_flush(&netif->rx_batch);
+#endif
         /* non-blocking msg check */
         int msg_waiting = msg_try_receive(msg);
         if (msg_waiting > 0) {
@@ -1947,6 +1956,9 @@ static void *_gnrc_netif_thread(void *args)
 
     /* setup the link-layer's message queue */
     msg_init_queue(netif->msg_queue, ARRAY_SIZE(netif->msg_queue));
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    memset(&netif->rx_batch, 0, sizeof(netif->rx_batch));
+#endif
     /* initialize low-level driver */
     ctx->result = netif->ops->init(netif);
     /* signal that driver init is done */
@@ -2040,8 +2052,14 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    /* passed on in _process_events_await_msg() once all events are handled */
+    gnrc_netapi_batch_add(&netif->rx_batch, pkt->type,
+                          GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+#else
+    (void)netif;
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -2049,6 +2067,7 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
+#endif
 }
 
 static void _event_cb(netdev_t *dev, netdev_event_t event)
@@ -2090,7 +2109,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
-                    _pass_on_packet(pkt);
+                    _pass_on_packet(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
@@ -28,6 +28,23 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   extra stack size if the upper layers handle received packets in
+ *          the netif thread
+ *
+ * The threads of the upper layers are kept, so this adds to the RAM used by
+ * the network stack for every interface.
+ *
+ * @see     @ref net_gnrc_netapi_direct
+ */
+#ifndef GNRC_NETIF_DIRECT_EXTRA_STACKSIZE
+#ifdef MODULE_GNRC_NETAPI_DIRECT
+#define GNRC_NETIF_DIRECT_EXTRA_STACKSIZE   (THREAD_STACKSIZE_DEFAULT)
+#else
+#define GNRC_NETIF_DIRECT_EXTRA_STACKSIZE   (0)
+#endif
+#endif
+
 /**
  * @brief   stack size of a netif thread
  *
@@ -35,7 +52,8 @@ extern "C" {
  *          stack size by default msg queue size to keep the RAM use the same
  */
 #ifndef GNRC_NETIF_STACKSIZE_DEFAULT
-#define GNRC_NETIF_STACKSIZE_DEFAULT    (THREAD_STACKSIZE_DEFAULT - 128)
+#define GNRC_NETIF_STACKSIZE_DEFAULT    (THREAD_STACKSIZE_DEFAULT - 128 + \
+                                         GNRC_NETIF_DIRECT_EXTRA_STACKSIZE)
 #endif
 
 /**
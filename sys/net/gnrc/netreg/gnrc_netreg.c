@@ -13,8 +13,9 @@
  */
 
 #include <errno.h>
-#include <string.h>
 #include <limits.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "assert.h"
 #include "log.h"
@@ -31,8 +32,20 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+/* A slot of the hash index: all entries of one type and demux context, linked
+ * by gnrc_netreg_entry_t::next. The slot is empty if entries is NULL. */
+typedef struct {
+    gnrc_netreg_entry_t *entries;
+    gnrc_nettype_t type;
+} _slot_t;
+
+/* The registry as open-addressing hash index by type and demux context */
+static _slot_t _index[CONFIG_GNRC_NETREG_HASH_SIZE];
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+#endif
 
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
@@ -63,9 +76,67 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    memset(_index, 0, sizeof(_index));
+#else
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+static unsigned _hash(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* multiplicative hashing, spreads consecutive ports over the index */
+    uint32_t key = (demux_ctx ^ ((uint32_t)type << 24)) * 0x9e3779b1U;
+
+    return (key >> 16) % CONFIG_GNRC_NETREG_HASH_SIZE;
+}
+
+/* Returns the slot of (type, demux_ctx) or the empty slot it would go to,
+ * NULL if there is neither */
+static _slot_t *_find(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    unsigned idx = _hash(type, demux_ctx);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETREG_HASH_SIZE; i++) {
+        _slot_t *slot = &_index[idx];
+
+        if ((slot->entries == NULL) ||
+            ((slot->type == type) && (slot->entries->demux_ctx == demux_ctx))) {
+            return slot;
+        }
+        idx = (idx + 1) % CONFIG_GNRC_NETREG_HASH_SIZE;
+    }
+    return NULL;
 }
 
+/* Empties slot and moves the slots behind it up where their probe sequence
+ * allows it, so _find() never has to skip deleted slots */
+static void _remove_slot(_slot_t *slot)
+{
+    unsigned hole = slot - _index;
+    unsigned idx = hole;
+
+    while (1) {
+        idx = (idx + 1) % CONFIG_GNRC_NETREG_HASH_SIZE;
+        _slot_t *next = &_index[idx];
+
+        if (next->entries == NULL) {
+            break;
+        }
+        unsigned home = _hash(next->type, next->entries->demux_ctx);
+        /* slot can not move if its home lies cyclically in (hole, idx] */
+        bool stays = (hole < idx) ? ((hole < home) && (home <= idx))
+                                  : ((hole < home) || (home <= idx));
+        if (!stays) {
+            _index[hole] = *next;
+            next->entries = NULL;
+            hole = idx;
+        }
+    }
+}
+#endif
+
 void gnrc_netreg_acquire_shared(void) {
     mutex_lock(&_lock_for_counter);
     if (_lock_counter == 0) {
@@ -132,8 +203,15 @@ static void _gnrc_netreg_release_exclusive(void) {
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
 #if DEVELHELP
-# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-    bool has_msg_q = (entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
+# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+      defined(MODULE_GNRC_NETAPI_BATCH) || \
+      defined(MODULE_GNRC_NETAPI_DIRECT)
+    /* batch entries are sent to their thread by message as well */
+    bool needs_msg_q = (entry->type == GNRC_NETREG_TYPE_DEFAULT);
+#  ifdef MODULE_GNRC_NETAPI_BATCH
+    needs_msg_q |= (entry->type == GNRC_NETREG_TYPE_BATCH);
+#  endif
+    bool has_msg_q = !needs_msg_q ||
                      thread_has_msg_queue(thread_get(entry->target.pid));
 # else
     bool has_msg_q = thread_has_msg_queue(thread_get(entry->target.pid));
@@ -153,13 +231,28 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    _slot_t *slot = _find(type, entry->demux_ctx);
+
+    if (slot == NULL) {
+        _gnrc_netreg_release_exclusive();
+        LOG_ERROR("gnrc_netreg: index full, increase "
+                  "CONFIG_GNRC_NETREG_HASH_SIZE\n");
+        return -ENOMEM;
+    }
+    gnrc_netreg_entry_t **head = &slot->entries;
+    slot->type = type;
+#else
+    gnrc_netreg_entry_t **head = &netreg[type];
+#endif
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*head, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*head, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +265,18 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    _slot_t *slot = _find(type, entry->demux_ctx);
+
+    if ((slot != NULL) && (slot->entries != NULL)) {
+        LL_DELETE(slot->entries, entry);
+        if (slot->entries == NULL) {
+            _remove_slot(slot);
+        }
+    }
+#else
     LL_DELETE(netreg[type], entry);
+#endif
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -213,10 +317,21 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
 
     gnrc_netreg_entry_t *res = NULL;
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+    /* all entries of a slot match */
+    if (from) {
+        res = from->next;
+    }
+    else if (!_INVALID_TYPE(type)) {
+        _slot_t *slot = _find(type, demux_ctx);
+        res = (slot) ? slot->entries : NULL;
+    }
+#else
     if (from || !_INVALID_TYPE(type)) {
         gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
+#endif
 
     return res;
 }
@@ -67,8 +67,29 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/* upper layer packets of a GNRC_NETAPI_MSG_TYPE_RCV_BATCH chain, passed on
+ * once the whole chain is handled */
+static gnrc_netapi_batch_t _rx_batch;
+static bool _rx_batching;
+#endif
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
+
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+/* message type of ICMPv6 packets handled directly up to the ICMPv6 header,
+ * passed on to the IPv6 thread */
+#define GNRC_IPV6_ICMPV6_DEMUX  (0xfe10U)
+
+/* handles received packets in the context of the dispatching thread */
+static bool _receive_direct(gnrc_pktsnip_t *pkt);
+
+static gnrc_netreg_entry_direct_t _direct = {
+    .recv = _receive_direct,
+    .lock = MUTEX_INIT,
+};
+#endif
 /* Sends packet over the appropriate interface(s).
  * prep_hdr: prepare header for sending (call to _fill_ipv6_hdr()), otherwise
  * assume it is already prepared */
@@ -116,6 +137,21 @@ static void _demux(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, unsigned nh)
     switch (nh) {
 #ifdef MODULE_GNRC_ICMPV6
         case PROTNUM_ICMPV6:
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+            if (thread_getpid() != gnrc_ipv6_pid) {
+                /* neighbor discovery may call into the interface
+                 * synchronously, which deadlocks in the interface thread */
+                msg_t msg = { .type = GNRC_IPV6_ICMPV6_DEMUX,
+                              .content = { .ptr = pkt } };
+
+                DEBUG("ipv6: pass ICMPv6 packet on to IPv6 thread\n");
+                if (msg_try_send(&msg, gnrc_ipv6_pid) < 1) {
+                    DEBUG("ipv6: IPv6 thread is busy, dropping ICMPv6\n");
+                    gnrc_pktbuf_release(pkt);
+                }
+                break;
+            }
+#endif
             DEBUG("ipv6: handle ICMPv6 packet (nh = %u)\n", nh);
             gnrc_icmpv6_demux(netif, pkt);
             break;
@@ -140,6 +176,22 @@ ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt)
 }
 
 /* internal functions */
+static void _dispatch_upper(gnrc_pktsnip_t *pkt)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    if (_rx_batching) {
+        gnrc_netapi_batch_add(&_rx_batch, pkt->type,
+                              GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+        return;
+    }
+#endif
+    if (gnrc_netapi_dispatch_receive(pkt->type,
+                                     GNRC_NETREG_DEMUX_CTX_ALL,
+                                     pkt) == 0) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
 static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
                                   bool interested)
 {
@@ -152,11 +204,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(pkt->type,
-                                     GNRC_NETREG_DEMUX_CTX_ALL,
-                                     pkt) == 0) {
-        gnrc_pktbuf_release(pkt);
-    }
+    _dispatch_upper(pkt);
     if (!has_nh_subs) {
         /* we should exit early. pkt was already released above */
         return;
@@ -170,21 +218,77 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+/* handles GNRC_NETAPI_MSG_TYPE_RCV_BATCH commands */
+static void _receive_batch(gnrc_pktsnip_t *pkts)
+{
+    _rx_batching = true;
+    while (pkts) {
+        /* _receive() may reuse the first snip for the upper layer packet */
+        gnrc_pktsnip_t *next = pkts->next_pkt;
+
+        _receive(pkts);
+        pkts = next;
+    }
+    _rx_batching = false;
+    gnrc_netapi_batch_flush(&_rx_batch);
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+static bool _receive_direct(gnrc_pktsnip_t *pkt)
+{
+    /* ICMPv6 is only known after the extension headers, _demux() passes it
+     * on to the IPv6 thread */
+    _receive(pkt);
+    return true;
+}
+
+/* handles ICMPv6 packets _demux() passed on from other threads */
+static void _demux_icmpv6(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    gnrc_netif_t *netif = NULL;
+
+    if (netif_hdr != NULL) {
+        netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
+    }
+    else {
+        netif = gnrc_netif_get_by_ipv6_addr(&gnrc_ipv6_get_header(pkt)->dst);
+    }
+    gnrc_icmpv6_demux(netif, pkt);
+}
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_DIRECT(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                               &_direct);
+#elif IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              thread_getpid());
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+    _direct.pid = thread_getpid();
+#endif
 
     /* initialize fragmentation data-structures */
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
     gnrc_ipv6_ext_frag_init();
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
     /* register interest in all IPv6 packets */
-    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
+    int res = gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
+    /* fails only if the netreg hash index is too small for the stack */
+    assert(res == 0);
+    (void)res;
 
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
@@ -193,6 +297,10 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+        /* keep other threads from handling packets in the meantime */
+        mutex_lock(&_direct.lock);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -200,6 +308,20 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                _receive_batch(msg.content.ptr);
+                break;
+#endif
+
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+            case GNRC_IPV6_ICMPV6_DEMUX:
+                DEBUG("ipv6: GNRC_IPV6_ICMPV6_DEMUX received\n");
+                _demux_icmpv6(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
@@ -253,6 +375,9 @@ static void *_event_loop(void *args)
             default:
                 break;
         }
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+        mutex_unlock(&_direct.lock);
+#endif
     }
 
     return NULL;
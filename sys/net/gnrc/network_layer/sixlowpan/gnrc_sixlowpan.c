@@ -39,6 +39,20 @@ static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
+
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+/* handles received packets in the context of the dispatching thread */
+static bool _receive_direct(gnrc_pktsnip_t *pkt)
+{
+    _receive(pkt);
+    return true;
+}
+
+static gnrc_netreg_entry_direct_t _direct = {
+    .recv = _receive_direct,
+    .lock = MUTEX_INIT,
+};
+#endif
 /* handles GNRC_NETAPI_MSG_TYPE_SND commands */
 static void _send(gnrc_pktsnip_t *pkt);
 /* Main event loop for 6LoWPAN */
@@ -386,14 +400,25 @@ static void _continue_fragmenting(gnrc_sixlowpan_frag_fb_t *fbuf)
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_DIRECT(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                               &_direct);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+    _direct.pid = thread_getpid();
+#endif
 
     /* register interest in all 6LoWPAN packets */
-    gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
+    int res = gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
+    /* fails only if the netreg hash index is too small for the stack */
+    assert(res == 0);
+    (void)res;
 
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
@@ -406,6 +431,10 @@ static void *_event_loop(void *args)
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
         msg_receive(&msg);
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+        /* keep other threads from handling packets in the meantime */
+        mutex_lock(&_direct.lock);
+#endif
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -451,6 +480,9 @@ static void *_event_loop(void *args)
                 DEBUG("6lo: operation not supported\n");
                 break;
         }
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+        mutex_unlock(&_direct.lock);
+#endif
     }
 
     return NULL;
@@ -0,0 +1,476 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf_slab
+ * @{
+ *
+ * @file
+ * @brief   Size class packet buffer implementation
+ *
+ * Every pool is a contiguous array of equally sized blocks with a @ref
+ * memarray_t free list. The block of a pointer, also of one into the middle
+ * of a block as left behind by gnrc_pktbuf_mark(), is found by its address,
+ * so releasing does not need any search.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "memarray.h"
+#include "mutex.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SNIP_SIZE       ((sizeof(gnrc_pktsnip_t) + 7U) & ~7U)
+#define SMALL_SIZE      CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define MEDIUM_SIZE     CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define LARGE_SIZE      CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define SNIP_NUMOF      CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define SMALL_NUMOF     CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define MEDIUM_NUMOF    CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define LARGE_NUMOF     CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+
+static_assert(((SMALL_SIZE % 8) == 0) && ((MEDIUM_SIZE % 8) == 0) &&
+              ((LARGE_SIZE % 8) == 0),
+              "gnrc_pktbuf_slab block sizes have to be a multiple of 8");
+static_assert((SNIP_SIZE <= SMALL_SIZE) && (SMALL_SIZE < MEDIUM_SIZE) &&
+              (MEDIUM_SIZE < LARGE_SIZE) && (LARGE_SIZE <= UINT16_MAX),
+              "gnrc_pktbuf_slab block sizes have to be ascending");
+
+static alignas(uint64_t) uint8_t _snips[SNIP_NUMOF][SNIP_SIZE];
+static alignas(uint64_t) uint8_t _small[SMALL_NUMOF][SMALL_SIZE];
+static alignas(uint64_t) uint8_t _medium[MEDIUM_NUMOF][MEDIUM_SIZE];
+static alignas(uint64_t) uint8_t _large[LARGE_NUMOF][LARGE_SIZE];
+
+/* bytes requested for every block in use, indexed by class offset + block */
+static uint16_t _lens[SNIP_NUMOF + SMALL_NUMOF + MEDIUM_NUMOF + LARGE_NUMOF];
+
+typedef struct {
+    memarray_t free;                        /* free blocks */
+    uint8_t *start;                         /* first block */
+    uint16_t *lens;                         /* requested bytes per block */
+    gnrc_pktbuf_slab_class_stats_t stats;
+} _class_t;
+
+static _class_t _classes[GNRC_PKTBUF_SLAB_CLASS_NUMOF] = {
+    [GNRC_PKTBUF_SLAB_SNIPS] = {
+        .start = &_snips[0][0],
+        .lens = &_lens[0],
+        .stats = { .size = SNIP_SIZE, .numof = SNIP_NUMOF },
+    },
+    [GNRC_PKTBUF_SLAB_SMALL] = {
+        .start = &_small[0][0],
+        .lens = &_lens[SNIP_NUMOF],
+        .stats = { .size = SMALL_SIZE, .numof = SMALL_NUMOF },
+    },
+    [GNRC_PKTBUF_SLAB_MEDIUM] = {
+        .start = &_medium[0][0],
+        .lens = &_lens[SNIP_NUMOF + SMALL_NUMOF],
+        .stats = { .size = MEDIUM_SIZE, .numof = MEDIUM_NUMOF },
+    },
+    [GNRC_PKTBUF_SLAB_LARGE] = {
+        .start = &_large[0][0],
+        .lens = &_lens[SNIP_NUMOF + SMALL_NUMOF + MEDIUM_NUMOF],
+        .stats = { .size = LARGE_SIZE, .numof = LARGE_NUMOF },
+    },
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline bool _in_class(const _class_t *cls, const void *ptr)
+{
+    const uint8_t *pos = ptr;
+    return (pos >= cls->start) &&
+           (pos < cls->start + (cls->stats.numof * cls->stats.size));
+}
+
+static _class_t *_class_of(const void *ptr)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_classes); i++) {
+        if (_in_class(&_classes[i], ptr)) {
+            return &_classes[i];
+        }
+    }
+    return NULL;
+}
+
+static inline unsigned _block_idx(const _class_t *cls, const void *ptr)
+{
+    return ((const uint8_t *)ptr - cls->start) / cls->stats.size;
+}
+
+static inline uint8_t *_block_start(const _class_t *cls, const void *ptr)
+{
+    return cls->start + (_block_idx(cls, ptr) * cls->stats.size);
+}
+
+/* allocates from the first class in [first, end) that fits `size` bytes and
+ * has a block left */
+static void *_alloc(unsigned first, unsigned end, size_t size)
+{
+    unsigned fit = first;
+
+    while ((fit < end) && (size > _classes[fit].stats.size)) {
+        fit++;
+    }
+    for (unsigned i = fit; i < end; i++) {
+        _class_t *cls = &_classes[i];
+        uint8_t *block = memarray_alloc(&cls->free);
+        if (block == NULL) {
+            continue;
+        }
+        if (i != fit) {
+            cls->stats.fallbacks++;
+        }
+        cls->stats.allocs++;
+        cls->stats.requested += size;
+        cls->lens[_block_idx(cls, block)] = size;
+        if (++cls->stats.used > cls->stats.max_used) {
+            cls->stats.max_used = cls->stats.used;
+        }
+        return block;
+    }
+    DEBUG("pktbuf: no block of %u bytes left\n", (unsigned)size);
+    if ((fit < end) && (end == GNRC_PKTBUF_SLAB_CLASS_NUMOF)) {
+        _classes[fit].stats.fails++;
+    }
+    return NULL;
+}
+
+static inline void *_alloc_data(size_t size)
+{
+    return _alloc(GNRC_PKTBUF_SLAB_SMALL, GNRC_PKTBUF_SLAB_CLASS_NUMOF, size);
+}
+
+static inline gnrc_pktsnip_t *_alloc_snip(void)
+{
+    /* Silence false -Wcast-align: all blocks are aligned to 8 bytes */
+    return (gnrc_pktsnip_t *)(uintptr_t)_alloc(GNRC_PKTBUF_SLAB_SNIPS,
+                                               GNRC_PKTBUF_SLAB_CLASS_NUMOF,
+                                               sizeof(gnrc_pktsnip_t));
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < ARRAY_SIZE(_classes); i++) {
+        _class_t *cls = &_classes[i];
+        memarray_init(&cls->free, cls->start, cls->stats.size,
+                      cls->stats.numof);
+        cls->stats.used = 0;
+        cls->stats.max_used = 0;
+        cls->stats.requested = 0;
+        cls->stats.allocs = 0;
+        cls->stats.fallbacks = 0;
+        cls->stats.fails = 0;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _alloc_snip();
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->size == size) {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    else {
+        /* blocks can not be split, so the (usually small) marked header is
+         * moved to a block of its own, while the rest stays in place */
+        new_data_marked = _alloc_data(size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+        pkt->size = 0;
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    void *new_data;
+    if (pkt->data == NULL) {
+        new_data = _alloc_data(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+    }
+    else {
+        _class_t *cls = _class_of(pkt->data);
+        unsigned cls_idx = cls - _classes;
+        uint8_t *block = _block_start(cls, pkt->data);
+        size_t offset = (uint8_t *)pkt->data - block;
+        bool fits = (offset + size) <= cls->stats.size;
+
+        new_data = NULL;
+        if (!fits) {
+            new_data = _alloc_data(size);
+        }
+        else if ((cls_idx > GNRC_PKTBUF_SLAB_SMALL) &&
+                 (size <= cls[-1].stats.size)) {
+            /* free the block for larger data if a smaller one does */
+            new_data = _alloc(GNRC_PKTBUF_SLAB_SMALL, cls_idx, size);
+        }
+        if (new_data == NULL) {
+            if (!fits) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&gnrc_pktbuf_mutex);
+                return ENOMEM;
+            }
+            uint16_t *len = &cls->lens[_block_idx(cls, block)];
+            cls->stats.requested = cls->stats.requested - *len + offset + size;
+            *len = offset + size;
+            pkt->size = size;
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return 0;
+        }
+        memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+    }
+    pkt->data = new_data;
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+void gnrc_pktbuf_slab_get_stats(gnrc_pktbuf_slab_class_stats_t stats[GNRC_PKTBUF_SLAB_CLASS_NUMOF])
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < ARRAY_SIZE(_classes); i++) {
+        stats[i] = _classes[i].stats;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snips", "small", "medium", "large" };
+    gnrc_pktbuf_slab_class_stats_t stats[GNRC_PKTBUF_SLAB_CLASS_NUMOF];
+
+    gnrc_pktbuf_slab_get_stats(stats);
+    printf("packet buffer: %u bytes in %u pools\n",
+           (unsigned)(sizeof(_snips) + sizeof(_small) + sizeof(_medium) +
+                      sizeof(_large)),
+           (unsigned)ARRAY_SIZE(stats));
+    puts("  pool   size  used/numof  max   wasted  allocs  fallbacks  fails");
+    for (unsigned i = 0; i < ARRAY_SIZE(stats); i++) {
+        printf("  %-6s %4u  %4u/%-5u  %4u  %6u  %6u  %9u  %5u\n", names[i],
+               stats[i].size, stats[i].used, stats[i].numof, stats[i].max_used,
+               (unsigned)(stats[i].used * stats[i].size - stats[i].requested),
+               (unsigned)stats[i].allocs, (unsigned)stats[i].fallbacks,
+               (unsigned)stats[i].fails);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_classes); i++) {
+        if (_classes[i].stats.used) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - every free block lies on a block boundary of its class
+     *  - free blocks and blocks in use add up to the blocks of the class
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_classes); i++) {
+        const _class_t *cls = &_classes[i];
+        unsigned free = 0;
+
+        for (uint8_t *block = cls->free.free_data; block != NULL;
+             memcpy(&block, block, sizeof(block))) {
+            if (!_in_class(cls, block) || (_block_start(cls, block) != block)) {
+                return false;
+            }
+            free++;
+        }
+        if ((free + cls->stats.used) != cls->stats.numof) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _alloc_snip();
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _alloc_data(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    _class_t *cls = _class_of(data);
+
+    (void)size;
+    if (cls == NULL) {
+        return;
+    }
+
+    uint8_t *block = _block_start(cls, data);
+    cls->stats.requested -= cls->lens[_block_idx(cls, block)];
+    cls->stats.used--;
+    memarray_free(&cls->free, block);
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    return _class_of(ptr) != NULL;
+}
+
+/** @} */
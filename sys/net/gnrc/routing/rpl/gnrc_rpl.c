@@ -103,7 +103,12 @@ kernel_pid_t gnrc_rpl_init(kernel_pid_t if_pid)
         _me_reg.demux_ctx = ICMPV6_RPL_CTRL;
         _me_reg.target.pid = gnrc_rpl_pid;
         /* register interest in all ICMPv6 packets */
-        gnrc_netreg_register(GNRC_NETTYPE_ICMPV6, &_me_reg);
+        if (gnrc_netreg_register(GNRC_NETTYPE_ICMPV6, &_me_reg) != 0) {
+            /* the netreg hash index is too small for the stack */
+            DEBUG("RPL: could not register with netreg\n");
+            assert(false);
+            return KERNEL_PID_UNDEF;
+        }
 
         gnrc_rpl_of_manager_init();
         evtimer_init_msg(&gnrc_rpl_evtimer);
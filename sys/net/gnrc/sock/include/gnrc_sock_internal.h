@@ -140,8 +140,11 @@ static inline void gnrc_ep_set(sock_ip_ep_t *out, const sock_ip_ep_t *in,
 /**
  * @brief   Create a sock internally
  * @internal
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the sock could not be registered
  */
-void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
+int gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
 
 /**
  * @brief   Receive a packet internally
@@ -55,8 +55,10 @@ int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
         }
         gnrc_ep_set(&sock->remote, remote, sizeof(sock_ip_ep_t));
     }
-    gnrc_sock_create(&sock->reg, GNRC_NETTYPE_IPV6,
-                     proto);
+    int res = gnrc_sock_create(&sock->reg, GNRC_NETTYPE_IPV6, proto);
+    if (res < 0) {
+        return res;
+    }
     sock->flags = flags;
     return 0;
 }
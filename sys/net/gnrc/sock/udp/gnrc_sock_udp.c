@@ -145,7 +145,15 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
     }
     if (local != NULL) {
         /* listen only with local given */
-        gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, sock->local.port);
+        int res = gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP,
+                                   sock->local.port);
+        if (res < 0) {
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+            /* remove again from current socks */
+            _udp_socks = (sock_udp_t *)sock->reg.next;
+#endif
+            return res;
+        }
     }
     sock->flags = flags;
     return 0;
@@ -367,7 +375,13 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            int res = gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            if (res < 0) {
+                /* leave sock unbound */
+                sock->local.family = AF_UNSPEC;
+                sock->local.port = 0;
+                return res;
+            }
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -292,7 +292,10 @@ static void *_eventloop(__attribute__((unused)) void *arg)
     /* Register GNRC TCPs handling thread in netreg */
     gnrc_netreg_entry_t entry;
     gnrc_netreg_entry_init_pid(&entry, GNRC_NETREG_DEMUX_CTX_ALL, _tcp_eventloop_pid);
-    gnrc_netreg_register(GNRC_NETTYPE_TCP, &entry);
+    int res = gnrc_netreg_register(GNRC_NETTYPE_TCP, &entry);
+    /* fails only if the netreg hash index is too small for the stack */
+    assert(res == 0);
+    (void)res;
 
     /* dispatch NETAPI messages */
     while (1) {
@@ -160,6 +160,20 @@ static void _receive(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+/* handles received packets in the context of the dispatching thread */
+static bool _receive_direct(gnrc_pktsnip_t *pkt)
+{
+    _receive(pkt);
+    return true;
+}
+
+static gnrc_netreg_entry_direct_t _direct = {
+    .recv = _receive_direct,
+    .lock = MUTEX_INIT,
+};
+#endif
+
 static void _send(gnrc_pktsnip_t *pkt)
 {
     udp_hdr_t *hdr;
@@ -221,24 +235,52 @@ static void *_event_loop(void *arg)
     (void)arg;
     msg_t msg, reply;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_DIRECT(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                               &_direct);
+#elif IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                              thread_getpid());
+#else
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
     /* initialize message queue */
     msg_init_queue(msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+    _direct.pid = thread_getpid();
+#endif
     /* register UPD at netreg */
-    gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
+    int res = gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
+    /* fails only if the netreg hash index is too small for the stack */
+    assert(res == 0);
+    (void)res;
 
     /* dispatch NETAPI messages */
     while (1) {
         msg_receive(&msg);
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+        /* keep other threads from handling packets in the meantime */
+        mutex_lock(&_direct.lock);
+#endif
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
                 _receive(msg.content.ptr);
                 break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_BATCH\n");
+                for (gnrc_pktsnip_t *pkt = msg.content.ptr, *next; pkt;
+                     pkt = next) {
+                    next = pkt->next_pkt;
+                    _receive(pkt);
+                }
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
@@ -251,6 +293,9 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: received unidentified message\n");
                 break;
         }
+#if IS_USED(MODULE_GNRC_NETAPI_DIRECT)
+        mutex_unlock(&_direct.lock);
+#endif
     }
 
     /* never reached */
@@ -31,6 +31,12 @@
 
 typedef unsigned (*ringbuffer_op_t)(ringbuffer_t *restrict rb, char *buf, unsigned n);
 
+static unsigned _ringbuffer_add(ringbuffer_t *restrict rb, char *buf, unsigned n)
+{
+    /* copies at most two spans, see ringbuffer_add_span() */
+    return ringbuffer_add(rb, buf, n);
+}
+
 static ssize_t pipe_rw(ringbuffer_t *rb,
                        void *buf,
                        size_t n,
@@ -87,7 +93,7 @@ ssize_t pipe_read(pipe_t *pipe, void *buf, size_t n)
 ssize_t pipe_write(pipe_t *pipe, const void *buf, size_t n)
 {
     return pipe_rw(pipe->rb, (char *) buf, n,
-                   &pipe->read_blocked, &pipe->write_blocked, (ringbuffer_op_t) ringbuffer_add);
+                   &pipe->read_blocked, &pipe->write_blocked, _ringbuffer_add);
 }
 
 void pipe_init(pipe_t *pipe, ringbuffer_t *rb, void (*free)(void *))
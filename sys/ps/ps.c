@@ -29,6 +29,14 @@
 #include "ztimer.h"
 #endif
 
+#ifdef MODULE_SCHED_EDF
+#include "sched_edf.h"
+#endif
+
+#ifdef MODULE_SCHED_BUDGET
+#include "sched_budget.h"
+#endif
+
 #ifdef MODULE_TLSF_MALLOC
 #include "tlsf.h"
 #include "tlsf-malloc.h"
@@ -53,6 +61,12 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHED_EDF
+           "| edf misses  "
+#endif
+#ifdef MODULE_SCHED_BUDGET
+           "| throttled   "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -119,6 +133,12 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHED_EDF
+                   " | %c %8u "
+#endif
+#ifdef MODULE_SCHED_BUDGET
+                   " | %c %8u "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -132,6 +152,13 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHED_EDF
+                   , sched_edf_is_admitted(i) ? '*' : ' ', sched_edf_misses(i)
+#endif
+#ifdef MODULE_SCHED_BUDGET
+                   , sched_budget_is_limited(i) ? '*' : ' ',
+                   sched_budget_throttled(i)
 #endif
                   );
         }
@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @ingroup     sched_budget
+ * @{
+ *
+ * @file
+ * @brief       CPU Time Budgets implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "sched_budget.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+typedef struct {
+    ztimer_t replenish;     /**< ends the period of a throttled thread */
+    uint32_t budget;        /**< CPU time per period */
+    uint32_t period;        /**< length of a period */
+    uint32_t release;       /**< start of the current period */
+    uint32_t used;          /**< CPU time used in the current period */
+    unsigned throttled;     /**< number of times the budget was used up */
+    kernel_pid_t pid;       /**< owner, KERNEL_PID_UNDEF if unused */
+} _budget_t;
+
+static void _enforce_cb(void *arg);
+
+static _budget_t _budgets[CONFIG_SCHED_BUDGET_NUMOF];
+/* throttles the running thread once its budget is used up */
+static ztimer_t _enforce = { .callback = _enforce_cb };
+/* reservation of the running thread, NULL if it has none */
+static _budget_t *_running;
+/* time _running got the CPU or was last charged */
+static uint32_t _started;
+/* number of reservations, nothing is measured while there are none */
+static unsigned _numof;
+
+static _budget_t *_find(kernel_pid_t pid)
+{
+    for (unsigned i = 0; i < CONFIG_SCHED_BUDGET_NUMOF; i++) {
+        if (_budgets[i].pid == pid) {
+            return &_budgets[i];
+        }
+    }
+    return NULL;
+}
+
+static void _charge(uint32_t now)
+{
+    _running->used += now - _started;
+    _started = now;
+}
+
+static void _replenish_cb(void *arg)
+{
+    _budget_t *b = arg;
+    thread_t *thread = thread_get(b->pid);
+
+    DEBUG("sched_budget: replenishing %" PRIkernel_pid "\n", b->pid);
+    b->used = 0;
+    b->release = ztimer_now(ZTIMER_USEC);
+    if (thread && (thread->status == STATUS_STOPPED)) {
+        sched_set_status(thread, STATUS_PENDING);
+        sched_switch(thread->priority);
+    }
+}
+
+static void _throttle(_budget_t *b, thread_t *thread, uint32_t now)
+{
+    DEBUG("sched_budget: throttling %" PRIkernel_pid "\n", thread->pid);
+    b->throttled++;
+
+    /* the runqueue may have been advanced past the thread, but removing it
+     * from the runqueue expects it to be in front */
+    sched_runq_move_to_front(thread);
+    sched_set_status(thread, STATUS_STOPPED);
+
+    int32_t left = b->release + b->period - now;
+    ztimer_set(ZTIMER_USEC, &b->replenish, (left > 0) ? left : 0);
+    thread_yield_higher();
+}
+
+static void _enforce_cb(void *arg)
+{
+    (void)arg;
+    _budget_t *b = _running;
+    thread_t *thread = thread_get_active();
+
+    if (!b || !thread || (thread->pid != b->pid)) {
+        return;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    _charge(now);
+    if (b->used < b->budget) {
+        ztimer_set(ZTIMER_USEC, &_enforce, b->budget - b->used);
+        return;
+    }
+    _throttle(b, thread, now);
+}
+
+void sched_budget_switch(thread_t *next)
+{
+    if (!_numof) {
+        return;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (_running) {
+        _charge(now);
+        _running = NULL;
+        ztimer_remove(ZTIMER_USEC, &_enforce);
+    }
+
+    _budget_t *b = next ? _find(next->pid) : NULL;
+    if (!b) {
+        return;
+    }
+
+    if (now - b->release >= b->period) {
+        /* the previous period is over, a new one starts now */
+        b->release = now;
+        b->used = 0;
+    }
+    _running = b;
+    _started = now;
+    /* an exhausted budget throttles the thread right away */
+    ztimer_set(ZTIMER_USEC, &_enforce,
+               (b->used < b->budget) ? b->budget - b->used : 0);
+}
+
+static void _release(_budget_t *b)
+{
+    if (ztimer_remove(ZTIMER_USEC, &b->replenish)) {
+        /* the thread is throttled, let it run unlimited again */
+        _replenish_cb(b);
+    }
+    if (_running == b) {
+        ztimer_remove(ZTIMER_USEC, &_enforce);
+        _running = NULL;
+    }
+    b->pid = KERNEL_PID_UNDEF;
+    _numof--;
+    ztimer_release(ZTIMER_USEC);
+}
+
+int sched_budget_set(kernel_pid_t pid, uint32_t budget, uint32_t period)
+{
+    if (!pid_is_valid(pid) || (budget > period)) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+    _budget_t *b = _find(pid);
+
+    if (!budget) {
+        if (b) {
+            _release(b);
+        }
+        irq_restore(state);
+        return 0;
+    }
+
+    if (!b) {
+        b = _find(KERNEL_PID_UNDEF);
+        if (!b) {
+            irq_restore(state);
+            return -ENOMEM;
+        }
+        /* keep the clock running while there are reservations */
+        ztimer_acquire(ZTIMER_USEC);
+        _numof++;
+        b->pid = pid;
+        b->replenish.callback = _replenish_cb;
+        b->replenish.arg = b;
+        b->throttled = 0;
+        b->used = 0;
+        b->release = ztimer_now(ZTIMER_USEC);
+    }
+    b->budget = budget;
+    b->period = period;
+    if (pid == thread_getpid()) {
+        /* start enforcing the budget of the running thread right away */
+        sched_budget_switch(thread_get_active());
+    }
+    irq_restore(state);
+
+    DEBUG("sched_budget: %" PRIkernel_pid " limited to %" PRIu32 "/%" PRIu32
+          "\n", pid, budget, period);
+    return 0;
+}
+
+void sched_budget_thread_exit(kernel_pid_t pid)
+{
+    _budget_t *b = _find(pid);
+
+    if (b) {
+        _release(b);
+    }
+}
+
+bool sched_budget_is_limited(kernel_pid_t pid)
+{
+    return pid_is_valid(pid) && _find(pid);
+}
+
+unsigned sched_budget_throttled(kernel_pid_t pid)
+{
+    _budget_t *b = pid_is_valid(pid) ? _find(pid) : NULL;
+
+    return b ? b->throttled : 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @ingroup     sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduling implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "clist.h"
+#include "container.h"
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "sched_edf.h"
+#if IS_USED(MODULE_SCHED_FEEDBACK)
+#include "sched_feedback.h"
+#endif
+#if IS_USED(MODULE_GNRC_NETIF)
+#include "net/gnrc/netif/conf.h"
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN)
+#include "net/gnrc/sixlowpan/config.h"
+#endif
+#if IS_USED(MODULE_GNRC_IPV6)
+#include "net/gnrc/ipv6.h"
+#endif
+#if IS_USED(MODULE_GNRC_UDP)
+#include "net/gnrc/udp.h"
+#endif
+#if IS_USED(MODULE_GNRC_PKTDUMP)
+#include "net/gnrc/pktdump.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* utilizations are fixed point numbers, this is 100% */
+#define UTILIZATION_ONE     (1UL << 16)
+#define UTILIZATION_LIMIT   ((SCHED_EDF_UTILIZATION_MAX * UTILIZATION_ONE) / 100)
+
+static_assert(SCHED_EDF_PRIO < SCHED_PRIO_LEVELS,
+              "SCHED_EDF_PRIO must be a valid priority");
+/* threads sharing the priority of the EDF threads only run once all EDF
+ * threads are done */
+#if IS_USED(MODULE_SCHED_FEEDBACK)
+static_assert((SCHED_EDF_PRIO < SCHED_FEEDBACK_LEVEL_FIRST) ||
+              (SCHED_EDF_PRIO > SCHED_FEEDBACK_LEVEL_LAST),
+              "SCHED_EDF_PRIO must not be a level of sched_feedback");
+#endif
+#if IS_USED(MODULE_GNRC_NETIF)
+static_assert(SCHED_EDF_PRIO != GNRC_NETIF_PRIO,
+              "SCHED_EDF_PRIO must differ from GNRC_NETIF_PRIO");
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN)
+static_assert(SCHED_EDF_PRIO != GNRC_SIXLOWPAN_PRIO,
+              "SCHED_EDF_PRIO must differ from GNRC_SIXLOWPAN_PRIO");
+#endif
+#if IS_USED(MODULE_GNRC_IPV6)
+static_assert(SCHED_EDF_PRIO != GNRC_IPV6_PRIO,
+              "SCHED_EDF_PRIO must differ from GNRC_IPV6_PRIO");
+#endif
+#if IS_USED(MODULE_GNRC_UDP)
+static_assert(SCHED_EDF_PRIO != GNRC_UDP_PRIO,
+              "SCHED_EDF_PRIO must differ from GNRC_UDP_PRIO");
+#endif
+#if IS_USED(MODULE_GNRC_PKTDUMP)
+static_assert(SCHED_EDF_PRIO != GNRC_PKTDUMP_PRIO,
+              "SCHED_EDF_PRIO must differ from GNRC_PKTDUMP_PRIO");
+#endif
+static_assert((SCHED_EDF_UTILIZATION_MAX > 0) && (SCHED_EDF_UTILIZATION_MAX <= 100),
+              "SCHED_EDF_UTILIZATION_MAX must be a percentage");
+
+typedef struct {
+    uint32_t deadline;      /**< absolute deadline of the current job */
+    uint32_t utilization;   /**< runtime / period, 0 if not admitted */
+    unsigned misses;        /**< number of jobs completed late */
+} _edf_t;
+
+static _edf_t _edf[KERNEL_PID_LAST + 1];
+static uint32_t _edf_utilization;
+
+static inline bool _before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+void sched_edf_runq_push(clist_node_t *runqueue, thread_t *thread)
+{
+    clist_node_t *node = &thread->rq_entry;
+    clist_node_t *last = runqueue->next;
+
+    if (last && _edf[thread->pid].utilization) {
+        uint32_t deadline = _edf[thread->pid].deadline;
+        clist_node_t *prev = last;
+        do {
+            clist_node_t *cur = prev->next;
+            kernel_pid_t pid = container_of(cur, thread_t, rq_entry)->pid;
+            /* threads not (or no longer) admitted go behind all others */
+            if (!_edf[pid].utilization || _before(deadline, _edf[pid].deadline)) {
+                node->next = cur;
+                prev->next = node;
+                return;
+            }
+            prev = cur;
+        } while (prev != last);
+    }
+
+    clist_rpush(runqueue, node);
+}
+
+/* put an already queued thread to the place matching its new deadline */
+static void _requeue(thread_t *thread)
+{
+    if (thread_is_active(thread) && (thread->priority == SCHED_EDF_PRIO)) {
+        clist_node_t *runqueue = &sched_runqueues[SCHED_EDF_PRIO];
+        clist_remove(runqueue, &thread->rq_entry);
+        sched_edf_runq_push(runqueue, thread);
+    }
+}
+
+int sched_edf_admit(thread_t *thread, uint32_t runtime, uint32_t period)
+{
+    assert(thread);
+
+    if ((runtime == 0) || (runtime > period)) {
+        return -EINVAL;
+    }
+
+    /* round up, admission must not be optimistic */
+    uint32_t utilization = (((uint64_t)runtime * UTILIZATION_ONE) + period - 1)
+                           / period;
+    _edf_t *edf = &_edf[thread->pid];
+
+    unsigned state = irq_disable();
+    if (_edf_utilization - edf->utilization + utilization > UTILIZATION_LIMIT) {
+        irq_restore(state);
+        DEBUG("sched_edf: rejecting %" PRIkernel_pid "\n", thread->pid);
+        return -ENOSPC;
+    }
+    if (!edf->utilization) {
+        edf->misses = 0;
+    }
+    _edf_utilization += utilization - edf->utilization;
+    edf->utilization = utilization;
+    edf->deadline = ztimer_now(SCHED_EDF_TIMERBASE) + period;
+    _requeue(thread);
+    irq_restore(state);
+
+    DEBUG("sched_edf: admitted %" PRIkernel_pid ", total utilization %"
+          PRIu32 "/%lu\n", thread->pid, _edf_utilization, UTILIZATION_ONE);
+
+    if (thread->priority == SCHED_EDF_PRIO) {
+        sched_switch(SCHED_EDF_PRIO);
+    }
+    else {
+        sched_change_priority(thread, SCHED_EDF_PRIO);
+    }
+    return 0;
+}
+
+void sched_edf_thread_exit(kernel_pid_t pid)
+{
+    _edf_utilization -= _edf[pid].utilization;
+    _edf[pid].utilization = 0;
+}
+
+void sched_edf_leave(thread_t *thread, uint8_t priority)
+{
+    assert(thread);
+
+    unsigned state = irq_disable();
+    sched_edf_thread_exit(thread->pid);
+    irq_restore(state);
+
+    sched_change_priority(thread, priority);
+}
+
+int thread_set_deadline(thread_t *thread, uint32_t deadline)
+{
+    assert(thread);
+
+    _edf_t *edf = &_edf[thread->pid];
+    if (!edf->utilization) {
+        return -EINVAL;
+    }
+
+    uint32_t now = ztimer_now(SCHED_EDF_TIMERBASE);
+
+    unsigned state = irq_disable();
+    if (_before(edf->deadline, now)) {
+        DEBUG("sched_edf: %" PRIkernel_pid " missed its deadline\n",
+              thread->pid);
+        edf->misses++;
+    }
+    edf->deadline = deadline;
+    _requeue(thread);
+    irq_restore(state);
+
+    /* a later deadline may have moved the running thread back */
+    sched_switch(SCHED_EDF_PRIO);
+    return 0;
+}
+
+unsigned sched_edf_misses(kernel_pid_t pid)
+{
+    return pid_is_valid(pid) ? _edf[pid].misses : 0;
+}
+
+bool sched_edf_is_admitted(kernel_pid_t pid)
+{
+    return pid_is_valid(pid) && _edf[pid].utilization;
+}
@@ -1,116 +1,302 @@
-#include "sched.h"																			// Inclusa per usufruire degli stati dei thread e degli stati delle code
-#include "thread.h"																			// Definisce i thread
-#include "ztimer.h"																			// Definisce i timer
-#include "sched_round_robin.h"																// Definisce macro utili per i timer
+/*
+ * Copyright (C) 2021 TUBA Freiberg
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @ingroup     sched_feedback
+ * @{
+ *
+ * @file
+ * @brief       Multilevel Feedback Scheduler implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "container.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "sched_feedback.h"
 
 #define ENABLE_DEBUG 0
-#include "debug.h"																			// Fornisce messaggi di errore utili
-
-#define MAX_Q 3
+#include "debug.h"
 
 static void _sched_feedback_cb(void *d);
 
-static ztimer_t _fb_timer = { .callback = _sched_feedback_cb };										// Quando il timer termina viene chiamata questa funzione
-
-static uint8_t _current_fb_priority = 0;															// La prima coda di priorità è la zero, poiché essa non è runnabile
-
-void sched_runq_callback(uint8_t prio);														// Viene definita la funzione di callback, questa funzione è legata alla funzione in sched.c
-
+static ztimer_t _fb_timer = { .callback = _sched_feedback_cb };
 
+static const uint32_t _fb_quanta[] = SCHED_FEEDBACK_QUANTA;
 
+static_assert(ARRAY_SIZE(_fb_quanta) == SCHED_FEEDBACK_LEVELS,
+              "SCHED_FEEDBACK_QUANTA must have one entry per feedback level");
+static_assert(SCHED_FEEDBACK_LEVEL_FIRST > 0,
+              "priority 0 can not be a feedback level");
+static_assert(SCHED_FEEDBACK_LEVEL_LAST < SCHED_PRIO_LEVELS,
+              "SCHED_FEEDBACK_LEVEL_LAST must be a valid priority");
 
+/*
+ * Assuming simple reads from and writes to a byte to be atomic on every board
+ * Value 0 is assumed to show this system is uninitialised.
+ * Value 0xff shows that the slice timer is not armed.
+ */
+static uint8_t _current_fb_priority = 0;
+/* whether the armed slice ends with a quantum, not only the service time */
+static bool _fb_quantum_armed;
 
+/* time of the last accounting, the active thread ran since then */
+static uint32_t _fb_last_account;
+/* time each thread entered a runqueue or was last seen running, used for
+ * aging */
+static uint32_t _fb_last_run[KERNEL_PID_LAST + 1];
 
+void sched_runq_callback(uint8_t prio);
 
-void _sched_feedback_cb(void *d)															// Questa è la funzione che viene chiamata quando il timer termina, quindi si presuppone che si arrivi a questo punto quando un thread conclude il suo quantum
+static inline bool _is_fb_level(uint8_t prio)
 {
+    return (prio >= SCHED_FEEDBACK_LEVEL_FIRST) &&
+           (prio <= SCHED_FEEDBACK_LEVEL_LAST);
+}
 
-    	(void)d;
-	uint8_t prio = _current_fb_priority;															// Preleva la coda corrente
-	thread_t *active_thread = thread_get_active();												// Preleva il PID del thread che era in running
-	uint8_t active_priority = active_thread->priority;												// Ne prelevo la priorità
-
-
-
-	if(prio != 0xff ){
-		_current_fb_priority = 0xff;															// Disattiva la coda corrente per evitare che venga eseguita durante l'esecuzione della funzione
-	}
+uint32_t sched_feedback_quantum(uint8_t prio)
+{
+    assert(_is_fb_level(prio));
+    return _fb_quanta[prio - SCHED_FEEDBACK_LEVEL_FIRST];
+}
 
+/*
+ * A quantum running out on @p prio only changes a scheduling decision if
+ * the thread running on that level has to share it or would be demoted
+ * below threads waiting on lower feedback levels.
+ */
+static bool _needs_quantum(uint8_t prio)
+{
+    if (sched_runq_is_empty(prio)) {
+        return false;
+    }
+    if (sched_runq_more_than_one(prio)) {
+        return true;
+    }
+    for (unsigned lower = prio + 1; lower <= SCHED_FEEDBACK_LEVEL_LAST; lower++) {
+        if (!sched_runq_is_empty(lower)) {
+            return true;
+        }
+    }
+    return false;
+}
 
-	if(active_thread->service_time == 0){
-		active_thread->status = 0;
-		sched_runq_advance(active_thread->priority);
-		thread_yield_higher();
-	}
+/*
+ * Time until the thread running on @p prio has to be looked at again: the end
+ * of its quantum or of its service time, whatever comes first.
+ * Returns 0 if nothing has to be done.
+ */
+static uint32_t _slice(uint8_t prio)
+{
+    if (sched_runq_is_empty(prio)) {
+        return 0;
+    }
 
+    uint32_t slice = _needs_quantum(prio) ? sched_feedback_quantum(prio) : 0;
+    int service_time = sched_runq_head(prio)->service_time;
 
-	if(active_thread && active_thread->service_time !=0) {										// Se il thread non è nullo
-		if (active_priority == prio && active_priority < MAX_Q) {									// Se la priorità del thread è uguale a quella che era corrente
-			
-			sched_change_priority(active_thread, active_priority+1);								// Allora faccio cambiare coda al thread aumentando la priorità
+    if ((service_time > 0) && ((slice == 0) || ((uint32_t)service_time < slice))) {
+        slice = service_time;
+    }
+    return slice;
+}
 
-			if(sched_runq_is_empty(prio)) {													// Se dopo il cambio di priorità la coda è vuota
-				prio++;																	// Prio incrementa
-			}
-			
+/*
+ * Charge @p thread with the time since the last accounting.
+ * Returns true if this used up its service time.
+ */
+static bool _account(thread_t *thread, uint32_t now)
+{
+    uint32_t elapsed = now - _fb_last_account;
 
-		}
+    _fb_last_account = now;
+    if (!thread) {
+        return false;
+    }
+    _fb_last_run[thread->pid] = now;
 
-		else if(active_priority == MAX_Q){													// Se la priorità del thread è 3
-			sched_runq_advance(MAX_Q);													// FIFO
-			thread_yield_higher();
-		}
-		active_thread->service_time -= 500000;
-	}
+    if (thread->service_time <= 0) {
+        /* unlimited service time */
+        return false;
+    }
+    if ((uint32_t)thread->service_time > elapsed) {
+        thread->service_time -= elapsed;
+        return false;
+    }
 
-	sched_runq_callback(prio);																// Richiamo la funzione di callback con la priorità passata
+    if (!thread_is_active(thread)) {
+        /* the thread blocked, stop it once it got the CPU again */
+        thread->service_time = 1;
+        return false;
+    }
 
+    DEBUG("sched_feedback: %" PRIkernel_pid " used up its service time\n",
+          thread->pid);
+    thread->service_time = 0;
+    /* the runqueue may have been advanced past the thread, but removing it
+     * from the runqueue expects it to be in front */
+    sched_runq_move_to_front(thread);
+    sched_set_status(thread, STATUS_STOPPED);
+    return true;
 }
 
+/*
+ * Promote the thread waiting longest on each lower feedback level if it
+ * starved for more than SCHED_FEEDBACK_AGING. Called from the quantum timer,
+ * which keeps ticking as long as threads wait on lower levels.
+ */
+static void _age(thread_t *active, uint32_t now)
+{
+    for (uint8_t prio = SCHED_FEEDBACK_LEVEL_FIRST + 1;
+         prio <= SCHED_FEEDBACK_LEVEL_LAST; prio++) {
+        if (sched_runq_is_empty(prio)) {
+            continue;
+        }
+
+        thread_t *waiting = sched_runq_head(prio);
+        if ((waiting == active) ||
+            (now - _fb_last_run[waiting->pid] < SCHED_FEEDBACK_AGING)) {
+            continue;
+        }
+
+        DEBUG("sched_feedback: promoting starved %" PRIkernel_pid " to %u\n",
+              waiting->pid, (unsigned)(prio - 1));
+        /* restart the aging period on the new level */
+        _fb_last_run[waiting->pid] = now;
+        sched_change_priority(waiting, prio - 1);
+    }
+}
 
-
-static inline void _sched_feedback_set(uint8_t prio)
+void sched_feedback_account(thread_t *active)
 {
-    if (prio == 0) {
+    if (_current_fb_priority == 0) {
         return;
     }
-    _current_fb_priority = prio;
-    ztimer_set(SCHED_RR_TIMERBASE, &_fb_timer, 500000);
+
+    _account(active, ztimer_now(SCHED_FEEDBACK_TIMERBASE));
 }
 
+void _sched_feedback_cb(void *d)
+{
+    (void)d;
+    uint8_t prio = _current_fb_priority;
+    _current_fb_priority = 0xff;
 
+    thread_t *active_thread = thread_get_active();
+    if (!active_thread) {
+        return;
+    }
 
+    uint32_t now = ztimer_now(SCHED_FEEDBACK_TIMERBASE);
+    if (_account(active_thread, now)) {
+        thread_yield_higher();
+        return;
+    }
 
+    if (SCHED_FEEDBACK_AGING && (SCHED_FEEDBACK_LEVELS > 1)) {
+        _age(active_thread, now);
+    }
 
+    uint8_t active_priority = active_thread->priority;
+    if ((active_priority != prio) || !_needs_quantum(prio)) {
+        sched_runq_callback(active_priority);
+    }
+    else if (prio < SCHED_FEEDBACK_LEVEL_LAST) {
+        DEBUG("sched_feedback: demoting %" PRIkernel_pid " to %u\n",
+              active_thread->pid, (unsigned)(prio + 1));
+        /* yields, the thread change will call the runqueue callback */
+        sched_change_priority(active_thread, prio + 1);
+    }
+    else {
+        /* round robin on the last level */
+        sched_runq_advance(prio);
+        thread_yield_higher();
+    }
+}
 
+static inline void _sched_feedback_remove(void)
+{
+    _current_fb_priority = 0xff;
+    ztimer_remove(SCHED_FEEDBACK_TIMERBASE, &_fb_timer);
+}
 
+static inline void _sched_feedback_set(uint8_t prio, uint32_t slice)
+{
+    _current_fb_priority = prio;
+    _fb_quantum_armed = _needs_quantum(prio);
+    ztimer_set(SCHED_FEEDBACK_TIMERBASE, &_fb_timer, slice);
+}
 
 void sched_runq_callback(uint8_t prio)
 {
-    if (prio == 0) {
+    uint8_t current = _current_fb_priority;
+
+    if (current == 0 || !_is_fb_level(prio)) {
         return;
     }
-    if (_current_fb_priority == 0xff) {
-        _sched_feedback_set(prio);
+
+    if (current != 0xff) {
+        /* keep the running slice, unless it only watches the service time
+         * and the level now needs a quantum */
+        if (_slice(current) && (_fb_quantum_armed || !_needs_quantum(current))) {
+            return;
+        }
+        /* nothing left to arbitrate or a quantum to start: stop ticking */
+        _sched_feedback_remove();
     }
 
+    uint32_t slice = _slice(prio);
+    if (slice) {
+        _sched_feedback_set(prio, slice);
+    }
 }
 
+void sched_feedback_runq_push(thread_t *thread, uint8_t prio)
+{
+    if ((_current_fb_priority == 0) || !_is_fb_level(prio)) {
+        return;
+    }
 
+    /* a thread starts waiting when it enters a runqueue, not when it last
+     * ran before blocking */
+    _fb_last_run[thread->pid] = ztimer_now(SCHED_FEEDBACK_TIMERBASE);
 
+    thread_t *active_thread = thread_get_active();
+    if (!active_thread ||
+        (active_thread == thread) || !_is_fb_level(active_thread->priority)) {
+        return;
+    }
 
-
-
-
-
+    /* The core only reports the runqueue of the running thread. A thread
+     * waiting on a lower feedback level gets the CPU only once the running
+     * one is demoted, which needs a quantum to run out. */
+    if (prio > active_thread->priority) {
+        sched_runq_callback(active_thread->priority);
+    }
+}
 
 void sched_feedback_init(void)
 {
-
-    	_current_fb_priority = 0xff;																// Viene settata la priorità come non inizializzata
-    	thread_t *active_thread = thread_get_active();
-	sched_change_priority(active_thread, 1);
-    	if (active_thread) {
-        	sched_runq_callback(active_thread->priority);
-    	}
+    /* init _current_fb_priority */
+    _current_fb_priority = 0xff;
+    _fb_last_account = ztimer_now(SCHED_FEEDBACK_TIMERBASE);
+    /* threads created before start waiting now */
+    for (unsigned pid = 0; pid <= KERNEL_PID_LAST; pid++) {
+        _fb_last_run[pid] = _fb_last_account;
+    }
+    /* the main thread takes part in feedback scheduling */
+    thread_t *active_thread = thread_get_active();
+    if (active_thread) {
+        sched_change_priority(active_thread, SCHED_FEEDBACK_LEVEL_FIRST);
+        sched_runq_callback(active_thread->priority);
+    }
 }
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @ingroup     sched_trace
+ * @{
+ *
+ * @file
+ * @brief       Scheduler Tracing implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "irq.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+#include "sched_trace.h"
+
+#ifdef CPU_NATIVE
+#include <fcntl.h>
+#include "native_internal.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define BUFMASK     (CONFIG_SCHED_TRACE_BUFSIZE - 1)
+
+static_assert((CONFIG_SCHED_TRACE_BUFSIZE & BUFMASK) == 0,
+              "CONFIG_SCHED_TRACE_BUFSIZE must be a power of 2");
+static_assert(sizeof(sched_trace_rec_t) == 10,
+              "the binary trace format relies on packed 10 byte records");
+
+static sched_trace_rec_t _buf[CONFIG_SCHED_TRACE_BUFSIZE];
+/* number of records written, only advanced after the record is complete */
+static volatile uint32_t _pos;
+/* false until ZTIMER_USEC can be read */
+static bool _enabled;
+
+void sched_trace_switch(thread_t *prev, thread_t *next)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    uint32_t pos = _pos;
+    sched_trace_rec_t *rec = &_buf[pos & BUFMASK];
+
+    rec->time = ztimer_now(ZTIMER_USEC);
+    rec->prev = prev ? prev->pid : KERNEL_PID_UNDEF;
+    rec->next = next->pid;
+    rec->reason = prev ? prev->status : SCHED_TRACE_REASON_IDLE;
+    rec->level = next->priority;
+    atomic_store_u32(&_pos, pos + 1);
+}
+
+void sched_trace_enable(bool on)
+{
+    if (on == _enabled) {
+        return;
+    }
+    /* keep the clock running while records are taken */
+    if (on) {
+        ztimer_acquire(ZTIMER_USEC);
+    }
+    _enabled = on;
+    if (!on) {
+        ztimer_release(ZTIMER_USEC);
+    }
+}
+
+void sched_trace_reset(void)
+{
+    unsigned state = irq_disable();
+    _pos = 0;
+    irq_restore(state);
+}
+
+uint32_t sched_trace_count(void)
+{
+    return atomic_load_u32(&_pos);
+}
+
+static ssize_t _write_name(sched_trace_write_t write, void *arg,
+                           kernel_pid_t pid)
+{
+    const char *name = thread_getname(pid);
+    struct __attribute__((packed)) {
+        int16_t pid;
+        uint8_t len;
+    } entry = { .pid = pid, .len = name ? strnlen(name, UINT8_MAX) : 0 };
+    ssize_t res = write(arg, &entry, sizeof(entry));
+
+    if ((res >= 0) && entry.len) {
+        res = write(arg, name, entry.len);
+    }
+    return res;
+}
+
+int sched_trace_dump(sched_trace_write_t write, void *arg)
+{
+    assert(write);
+
+    /* the name table must match the count in the header, even if threads
+     * are created while it is written */
+    kernel_pid_t pids[MAXTHREADS];
+    unsigned names = 0;
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid)) {
+            pids[names++] = pid;
+        }
+    }
+
+    uint32_t end = atomic_load_u32(&_pos);
+    uint32_t start = (end > CONFIG_SCHED_TRACE_BUFSIZE)
+                   ? end - CONFIG_SCHED_TRACE_BUFSIZE : 0;
+    sched_trace_hdr_t hdr = {
+        .magic = SCHED_TRACE_MAGIC,
+        .version = SCHED_TRACE_VERSION,
+        .rec_size = sizeof(sched_trace_rec_t),
+        .names = names,
+        .ticks_per_sec = US_PER_SEC,
+        .lost = start,
+    };
+    ssize_t res;
+
+    if ((res = write(arg, &hdr, sizeof(hdr))) < 0) {
+        return res;
+    }
+    for (unsigned i = 0; i < names; i++) {
+        if ((res = _write_name(write, arg, pids[i])) < 0) {
+            return res;
+        }
+    }
+
+    int count = 0;
+    for (uint32_t i = start; i != end; i++) {
+        sched_trace_rec_t rec = _buf[i & BUFMASK];
+        /* the scheduler may have overwritten the slot while it was copied */
+        if (atomic_load_u32(&_pos) - i > CONFIG_SCHED_TRACE_BUFSIZE) {
+            DEBUG("sched_trace: record %" PRIu32 " overwritten\n", i);
+            continue;
+        }
+        if ((res = write(arg, &rec, sizeof(rec))) < 0) {
+            return res;
+        }
+        count++;
+    }
+    return count;
+}
+
+#ifdef CPU_NATIVE
+static ssize_t _write_fd(void *arg, const void *data, size_t len)
+{
+    int fd = (intptr_t)arg;
+    const uint8_t *pos = data;
+
+    while (len) {
+        _native_syscall_enter();
+        ssize_t res = real_write(fd, pos, len);
+        _native_syscall_leave();
+        if (res < 0) {
+            return -errno;
+        }
+        pos += res;
+        len -= res;
+    }
+    return pos - (const uint8_t *)data;
+}
+
+int sched_trace_dump_file(const char *path)
+{
+    _native_syscall_enter();
+    int fd = real_open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    _native_syscall_leave();
+    if (fd < 0) {
+        return -errno;
+    }
+
+    int res = sched_trace_dump(_write_fd, (void *)(intptr_t)fd);
+
+    _native_syscall_enter();
+    real_close(fd);
+    _native_syscall_leave();
+    return res;
+}
+#endif
+
+void sched_trace_init(void)
+{
+    sched_trace_enable(true);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to control the scheduler tracer
+ *
+ * @note        Enable this by using the modules shell_cmds and sched_trace
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shell.h"
+#include "sched_trace.h"
+
+static ssize_t _write_hex(void *arg, const void *data, size_t len)
+{
+    (void)arg;
+    const uint8_t *pos = data;
+
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", pos[i]);
+    }
+    puts("");
+    return len;
+}
+
+static int _dump(const char *path)
+{
+    int res;
+
+    if (path) {
+#ifdef CPU_NATIVE
+        res = sched_trace_dump_file(path);
+#else
+        puts("schedtrace: dumping into a file is only supported on native");
+        return EXIT_FAILURE;
+#endif
+    }
+    else {
+        puts("--- sched_trace begin ---");
+        res = sched_trace_dump(_write_hex, NULL);
+        puts("--- sched_trace end ---");
+    }
+
+    if (res < 0) {
+        printf("schedtrace: dump failed (%d)\n", res);
+        return EXIT_FAILURE;
+    }
+    printf("schedtrace: %d records dumped\n", res);
+    return EXIT_SUCCESS;
+}
+
+static int _sc_sched_trace(int argc, char **argv)
+{
+    if ((argc < 2) || (argc > 3)) {
+        goto usage;
+    }
+
+    if (!strcmp(argv[1], "start")) {
+        sched_trace_enable(true);
+    }
+    else if (!strcmp(argv[1], "stop")) {
+        sched_trace_enable(false);
+    }
+    else if (!strcmp(argv[1], "reset")) {
+        sched_trace_reset();
+    }
+    else if (!strcmp(argv[1], "count")) {
+        printf("%" PRIu32 "\n", sched_trace_count());
+    }
+    else if (!strcmp(argv[1], "dump")) {
+        return _dump((argc == 3) ? argv[2] : NULL);
+    }
+    else {
+        goto usage;
+    }
+    return EXIT_SUCCESS;
+
+usage:
+    printf("usage: %s start|stop|reset|count\n"
+           "       %s dump [file]\n"
+           "Without a file the binary trace is printed hex encoded, "
+           "dist/tools/sched_trace converts it.\n", argv[0], argv[0]);
+    return EXIT_FAILURE;
+}
+
+SHELL_COMMAND(schedtrace, "Control the scheduler tracer", _sc_sched_trace);
@@ -12,107 +12,212 @@
  * @file
  * @brief       thread-safe ringbuffer implementation
  *
+ * Every operation first takes a snapshot of the counters, then copies the
+ * data in at most two contiguous spans and finally publishes the counter it
+ * owns. Without `tsrb_spsc`, this all happens with interrupts disabled. With
+ * `tsrb_spsc`, the counters are accessed atomically instead: the data is
+ * copied before the counter is published, and the other side only ever
+ * advances its own counter, so the snapshot stays valid. The span functions
+ * rely on the same property to hand out the buffer memory outside of the
+ * critical section.
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
  */
 
+#include <assert.h>
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
-static void _push(tsrb_t *rb, uint8_t c)
+#if IS_USED(MODULE_TSRB_SPSC)
+static inline unsigned _lock(void)
+{
+    return 0;
+}
+
+static inline void _unlock(unsigned state)
+{
+    (void)state;
+}
+
+static inline unsigned _load(const unsigned *var)
+{
+    return _tsrb_load(var);
+}
+
+static inline void _store(unsigned *var, unsigned val)
+{
+    _tsrb_store(var, val);
+}
+#else
+static inline unsigned _lock(void)
+{
+    return irq_disable();
+}
+
+static inline void _unlock(unsigned state)
+{
+    irq_restore(state);
+}
+
+static inline unsigned _load(const unsigned *var)
+{
+    return *var;
+}
+
+static inline void _store(unsigned *var, unsigned val)
 {
-    rb->buf[rb->writes++ & (rb->size - 1)] = c;
+    *var = val;
 }
+#endif
 
-static uint8_t _pop(tsrb_t *rb)
+static size_t _min(size_t a, size_t b)
 {
-    return rb->buf[rb->reads++ & (rb->size - 1)];
+    return (a < b) ? a : b;
 }
 
-static uint8_t _peek(tsrb_t *rb, unsigned int idx)
+static void _copy_out(const tsrb_t *rb, unsigned pos, uint8_t *dst, size_t n)
 {
-    return rb->buf[(rb->reads + idx) & (rb->size - 1)];
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = _min(n, rb->size - idx);
+
+    memcpy(dst, &rb->buf[idx], first);
+    if (n > first) {
+        memcpy(dst + first, rb->buf, n - first);
+    }
+}
+
+static void _copy_in(tsrb_t *rb, unsigned pos, const uint8_t *src, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = _min(n, rb->size - idx);
+
+    memcpy(&rb->buf[idx], src, first);
+    if (n > first) {
+        memcpy(rb->buf, src + first, n - first);
+    }
 }
 
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
-    unsigned irq_state = irq_disable();
-    if (!tsrb_empty(rb)) {
-        retval = _pop(rb);
+    unsigned irq_state = _lock();
+    unsigned reads = rb->reads;
+    if (reads != _load(&rb->writes)) {
+        retval = rb->buf[reads & (rb->size - 1)];
+        _store(&rb->reads, reads + 1);
     }
-    irq_restore(irq_state);
+    _unlock(irq_state);
     return retval;
 }
 
 int tsrb_peek_one(tsrb_t *rb)
 {
     int retval = -1;
-    unsigned irq_state = irq_disable();
-    if (!tsrb_empty(rb)) {
-        retval = _peek(rb, 0);
+    unsigned irq_state = _lock();
+    unsigned reads = rb->reads;
+    if (reads != _load(&rb->writes)) {
+        retval = rb->buf[reads & (rb->size - 1)];
     }
-    irq_restore(irq_state);
+    _unlock(irq_state);
     return retval;
 }
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
-    unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
-    irq_restore(irq_state);
-    return (n - tmp);
+    unsigned irq_state = _lock();
+    unsigned reads = rb->reads;
+    n = _min(n, _load(&rb->writes) - reads);
+    _copy_out(rb, reads, dst, n);
+    _store(&rb->reads, reads + n);
+    _unlock(irq_state);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
-    unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
-    }
-    irq_restore(irq_state);
-    return idx;
+    unsigned irq_state = _lock();
+    unsigned reads = rb->reads;
+    n = _min(n, _load(&rb->writes) - reads);
+    _copy_out(rb, reads, dst, n);
+    _unlock(irq_state);
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
-    unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
-    }
-    irq_restore(irq_state);
-    return (n - tmp);
+    unsigned irq_state = _lock();
+    unsigned reads = rb->reads;
+    n = _min(n, _load(&rb->writes) - reads);
+    _store(&rb->reads, reads + n);
+    _unlock(irq_state);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
 {
     int retval = -1;
-    unsigned irq_state = irq_disable();
-    if (!tsrb_full(rb)) {
-        _push(rb, c);
+    unsigned irq_state = _lock();
+    unsigned writes = rb->writes;
+    if ((writes - _load(&rb->reads)) != rb->size) {
+        rb->buf[writes & (rb->size - 1)] = c;
+        _store(&rb->writes, writes + 1);
         retval = 0;
     }
-    irq_restore(irq_state);
+    _unlock(irq_state);
     return retval;
 }
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
-    unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
-    }
-    irq_restore(irq_state);
-    return (n - tmp);
+    unsigned irq_state = _lock();
+    unsigned writes = rb->writes;
+    n = _min(n, rb->size - (writes - _load(&rb->reads)));
+    _copy_in(rb, writes, src, n);
+    _store(&rb->writes, writes + n);
+    _unlock(irq_state);
+    return n;
+}
+
+unsigned tsrb_get_span(tsrb_t *rb, const uint8_t **data)
+{
+    unsigned irq_state = _lock();
+    unsigned reads = rb->reads;
+    unsigned idx = reads & (rb->size - 1);
+    unsigned n = _min(_load(&rb->writes) - reads, rb->size - idx);
+    _unlock(irq_state);
+
+    *data = &rb->buf[idx];
+    return n;
+}
+
+void tsrb_get_commit(tsrb_t *rb, unsigned n)
+{
+    unsigned irq_state = _lock();
+    assert(n <= _load(&rb->writes) - rb->reads);
+    _store(&rb->reads, rb->reads + n);
+    _unlock(irq_state);
+}
+
+unsigned tsrb_add_span(tsrb_t *rb, uint8_t **data)
+{
+    unsigned irq_state = _lock();
+    unsigned writes = rb->writes;
+    unsigned idx = writes & (rb->size - 1);
+    unsigned n = _min(rb->size - (writes - _load(&rb->reads)), rb->size - idx);
+    _unlock(irq_state);
+
+    *data = &rb->buf[idx];
+    return n;
+}
+
+void tsrb_add_commit(tsrb_t *rb, unsigned n)
+{
+    unsigned irq_state = _lock();
+    assert(n <= rb->size - (rb->writes - _load(&rb->reads)));
+    _store(&rb->writes, rb->writes + n);
+    _unlock(irq_state);
 }
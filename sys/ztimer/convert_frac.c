@@ -22,9 +22,11 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <inttypes.h>
 
+#include "container.h"
 #include "frac.h"
 #include "assert.h"
 #include "irq.h"
@@ -45,16 +47,28 @@ static void ztimer_convert_frac_compute_scale(ztimer_convert_frac_t *self,
                                               uint32_t freq_self,
                                               uint32_t freq_lower);
 
-static void ztimer_convert_frac_op_set(ztimer_clock_t *z, uint32_t val)
+static void _set_lower(ztimer_convert_frac_t *self, uint32_t val,
+                       uint32_t target_lower)
 {
-    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
-    uint32_t target_lower = frac_scale(&self->scale_set, val + self->round);
-
     DEBUG("ztimer_convert_frac_op_set(%" PRIu32 ")=%" PRIu32 "\n", val,
           target_lower);
     ztimer_set(self->super.lower, &self->super.lower_entry, target_lower);
 }
 
+static uint32_t _now_scaled(uint32_t lower_now, uint32_t scaled)
+{
+    DEBUG("ztimer_convert_frac_op_now() %" PRIu32 "->%" PRIu32 "\n", lower_now,
+          scaled);
+    return scaled;
+}
+
+static void ztimer_convert_frac_op_set(ztimer_clock_t *z, uint32_t val)
+{
+    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
+
+    _set_lower(self, val, frac_scale(&self->scale_set, val + self->round));
+}
+
 static uint32_t ztimer_convert_frac_op_now(ztimer_clock_t *z)
 {
     ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
@@ -63,11 +77,7 @@ static uint32_t ztimer_convert_frac_op_now(ztimer_clock_t *z)
     if (lower_now == 0) {
         return 0;
     }
-    uint32_t scaled = frac_scale(&self->scale_now, lower_now);
-
-    DEBUG("ztimer_convert_frac_op_now() %" PRIu32 "->%" PRIu32 "\n", lower_now,
-          scaled);
-    return scaled;
+    return _now_scaled(lower_now, frac_scale(&self->scale_now, lower_now));
 }
 
 static const ztimer_ops_t ztimer_convert_frac_ops = {
@@ -80,6 +90,106 @@ static const ztimer_ops_t ztimer_convert_frac_ops = {
 #endif
 };
 
+#if CONFIG_ZTIMER_CONVERT_FRAC_CONST
+/* Precomputed conversions for the frequencies ZTIMER_MSEC is commonly
+ * derived from. The fractions are what frac_init() computes for them (see
+ * tests/frac-config), the scaling functions return exactly what frac_scale()
+ * returns for every 32 bit input, but with constant operands. */
+static const frac_t _frac_32768_to_1000 = { .frac = 0xfa000000, .shift = 37 };
+static const frac_t _frac_1000_to_32768 = { .frac = 0x83126e98, .shift = 26 };
+static const frac_t _frac_1000000_to_1000 = { .frac = 0x83126e98, .shift = 41 };
+static const frac_t _frac_1000_to_1000000 = { .frac = 0xfa000000, .shift = 22 };
+
+static void _op_set_32768_to_1000(ztimer_clock_t *z, uint32_t val)
+{
+    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
+
+    _set_lower(self, val, frac_scale(&_frac_1000_to_32768, val + self->round));
+}
+
+static uint32_t _op_now_32768_to_1000(ztimer_clock_t *z)
+{
+    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
+    uint32_t lower_now = ztimer_now(self->super.lower);
+
+    /* lower_now * 125 / 4096, split up to stay within 32 bits */
+    return _now_scaled(lower_now, (lower_now >> 12) * 125 +
+                       (((lower_now & 0xfff) * 125) >> 12));
+}
+
+static void _op_set_1000000_to_1000(ztimer_clock_t *z, uint32_t val)
+{
+    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
+
+    _set_lower(self, val, (val + self->round) * 1000);
+}
+
+static uint32_t _op_now_1000000_to_1000(ztimer_clock_t *z)
+{
+    ztimer_convert_frac_t *self = (ztimer_convert_frac_t *)z;
+    uint32_t lower_now = ztimer_now(self->super.lower);
+
+    return _now_scaled(lower_now, lower_now / 1000);
+}
+
+static const ztimer_ops_t _ops_32768_to_1000 = {
+    .set = _op_set_32768_to_1000,
+    .now = _op_now_32768_to_1000,
+    .cancel = ztimer_convert_cancel,
+#if MODULE_ZTIMER_ONDEMAND
+    .start = ztimer_convert_start,
+    .stop = ztimer_convert_stop,
+#endif
+};
+
+static const ztimer_ops_t _ops_1000000_to_1000 = {
+    .set = _op_set_1000000_to_1000,
+    .now = _op_now_1000000_to_1000,
+    .cancel = ztimer_convert_cancel,
+#if MODULE_ZTIMER_ONDEMAND
+    .start = ztimer_convert_start,
+    .stop = ztimer_convert_stop,
+#endif
+};
+
+static const struct {
+    uint32_t freq_self;
+    uint32_t freq_lower;
+    const frac_t *scale_now;
+    const frac_t *scale_set;
+    const ztimer_ops_t *ops;
+} _const_convs[] = {
+    { 1000, 32768, &_frac_32768_to_1000, &_frac_1000_to_32768,
+      &_ops_32768_to_1000 },
+    { 1000, 1000000, &_frac_1000000_to_1000, &_frac_1000_to_1000000,
+      &_ops_1000000_to_1000 },
+};
+
+static bool _use_const_conv(ztimer_convert_frac_t *self, uint32_t freq_self,
+                            uint32_t freq_lower)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_const_convs); i++) {
+        if ((_const_convs[i].freq_self == freq_self) &&
+            (_const_convs[i].freq_lower == freq_lower)) {
+            self->scale_now = *_const_convs[i].scale_now;
+            self->scale_set = *_const_convs[i].scale_set;
+            self->super.super.ops = _const_convs[i].ops;
+            return true;
+        }
+    }
+    return false;
+}
+#else
+static bool _use_const_conv(ztimer_convert_frac_t *self, uint32_t freq_self,
+                            uint32_t freq_lower)
+{
+    (void)self;
+    (void)freq_self;
+    (void)freq_lower;
+    return false;
+}
+#endif /* CONFIG_ZTIMER_CONVERT_FRAC_CONST */
+
 static void ztimer_convert_frac_compute_scale(ztimer_convert_frac_t *self,
                                               uint32_t freq_self,
                                               uint32_t freq_lower)
@@ -104,7 +214,9 @@ void ztimer_convert_frac_init(ztimer_convert_frac_t *self,
         { .callback = (void (*)(void *)) ztimer_handler, .arg = &self->super, },
     };
 
-    ztimer_convert_frac_compute_scale(self, freq_self, freq_lower);
+    if (!_use_const_conv(self, freq_self, freq_lower)) {
+        ztimer_convert_frac_compute_scale(self, freq_self, freq_lower);
+    }
     if (freq_self < freq_lower) {
         self->super.super.max_value = frac_scale(&self->scale_now, UINT32_MAX);
 #if !MODULE_ZTIMER_ONDEMAND
@@ -32,18 +32,25 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_OVERHEAD
+#include "ztimer/overhead.h"
+#endif
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 #include "log.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
 
-#ifdef MODULE_ZTIMER_EXTEND
+#if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_WHEEL || MODULE_ZTIMER_SLACK
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 {
     return a < b ? a : b;
@@ -114,6 +121,11 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_is_set(clock->wheel, &t->base);
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -156,7 +168,8 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+static uint32_t _set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                     uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -178,6 +191,12 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
     uint32_t now = _ztimer_update_head_offset(clock);
 
+#if MODULE_ZTIMER_SLACK
+    /* deadline the clock is armed for, relative to clock->list.offset */
+    uint32_t deadline;
+    bool was_armed = _next_offset(clock, &deadline);
+#endif
+
     bool was_set = false;
     if (_is_set(clock, timer)) {
         was_set = _del_entry_from_list(clock, &timer->base);
@@ -191,9 +210,26 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+#if MODULE_ZTIMER_SLACK
+    timer->slack = slack;
+#else
+    (void)slack;
+#endif
+
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    bool update = _add_entry_to_list(clock, &timer->base);
+#if MODULE_ZTIMER_SLACK
+    /* with slack, the clock is armed for the coalesced deadline, which a
+     * timer set behind the first one may move as well, while a new first
+     * timer may leave it as it is */
+    uint32_t offset;
+    _next_offset(clock, &offset);
+    update = !was_armed || (offset != deadline);
+#endif
+    if (update && !clock->in_handler) {
+        /* the timer is the first to expire, but a timer wheel may have to
+         * cascade earlier */
+        _next_offset(clock, &val);
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -221,8 +257,46 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 {
+    return _set(clock, timer, val, 0);
+}
+
+#if MODULE_ZTIMER_SLACK
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack)
+{
+    return _set(clock, timer, val, slack);
+}
+#endif
+
+#if MODULE_ZTIMER_WHEEL
+static bool _add_entry_to_wheel(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_wheel_t *wheel = clock->wheel;
+    /* the wheel stays behind while timers are overdue */
+    uint32_t lag = clock->list.offset - wheel->base;
+    uint32_t val = _min_u32(entry->offset, UINT32_MAX - lag);
+
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+    if (ztimer_wheel_is_empty(wheel) &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_block(clock->block_pm_mode);
+    }
+#endif
+
+    return ztimer_wheel_add(wheel, entry, clock->list.offset + val);
+}
+#endif
+
+static bool _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return _add_entry_to_wheel(clock, entry);
+    }
+#endif
+
     uint32_t delta_sum = 0;
 
     ztimer_base_t *list = &clock->list;
@@ -258,6 +332,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
 
+    return clock->list.next == entry;
 }
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
@@ -269,7 +344,9 @@ static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
 }
 
 #ifdef MODULE_ZTIMER_EXTEND
-ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
+/* moves the checkpoint to the current time, bumping the epoch so that
+ * concurrent readers in _ztimer_now_extend() retry */
+static ztimer_now_t _ztimer_checkpoint(ztimer_clock_t *clock)
 {
     assert(clock->max_value);
     unsigned state = irq_disable();
@@ -283,20 +360,73 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
     clock->checkpoint += _add_modulo(lower_now, clock->lower_last,
                                      clock->max_value);
     clock->lower_last = lower_now;
+    clock->epoch++;
     DEBUG("ztimer_now() returning %" PRIu32 "\n", (uint32_t)clock->checkpoint);
     ztimer_now_t now = clock->checkpoint;
 
     irq_restore(state);
     return now;
 }
+
+ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
+{
+    assert(clock->max_value);
+    const volatile ztimer_clock_t *vclock = clock;
+    ztimer_now_t checkpoint;
+    uint32_t lower_last;
+    uint32_t lower_now;
+    uint16_t epoch;
+
+    /* The checkpoint is only written with IRQs disabled, so reading it is
+     * consistent if no checkpoint happened in between */
+    do {
+        epoch = vclock->epoch;
+        checkpoint = vclock->checkpoint;
+        lower_last = vclock->lower_last;
+        lower_now = clock->ops->now(clock);
+    } while (vclock->epoch != epoch);
+
+    uint32_t diff = _add_modulo(lower_now, lower_last, clock->max_value);
+
+    if (diff > (clock->max_value >> 1)) {
+        /* ztimer_handler() checkpoints at least every half period, unless
+         * the clock is not running timers (yet) */
+        return _ztimer_checkpoint(clock);
+    }
+    return checkpoint + diff;
+}
 #endif /* MODULE_ZTIMER_EXTEND */
 
+#if MODULE_ZTIMER_SLACK
+/* overdue timers have less of their slack left */
+static void _consume_slack(ztimer_base_t *entry, uint32_t overdue)
+{
+    ztimer_t *timer = (ztimer_t *)entry;
+
+    timer->slack -= _min_u32(timer->slack, overdue);
+}
+#else
+static inline void _consume_slack(ztimer_base_t *entry, uint32_t overdue)
+{
+    (void)entry;
+    (void)overdue;
+}
+#endif
+
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
 {
     uint32_t old_base = clock->list.offset;
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_wheel_advance(clock->wheel, now);
+        clock->list.offset = now;
+        return now;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     DEBUG(
@@ -314,6 +444,7 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
                 if (diff) {
                     /* skip timers with offset==0 */
                     do {
+                        _consume_slack(entry, diff);
                         entry = entry->next;
                     } while (entry && (entry->offset == 0));
                 }
@@ -334,8 +465,32 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     return now;
 }
 
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND && MODULE_ZTIMER_WHEEL
+static void _wheel_pm_unblock(ztimer_clock_t *clock)
+{
+    /* The last timer just got removed from the clock's wheel */
+    if (ztimer_wheel_is_empty(clock->wheel) &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->block_pm_mode);
+    }
+}
+#else
+static inline void _wheel_pm_unblock(ztimer_clock_t *clock)
+{
+    (void)clock;
+}
+#endif
+
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_wheel_del(clock->wheel, entry);
+        _wheel_pm_unblock(clock);
+        return true;
+    }
+#endif
+
     bool was_removed = false;
 
     DEBUG("_del_entry_from_list()\n");
@@ -379,6 +534,16 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        ztimer_base_t *entry = ztimer_wheel_pop(clock->wheel);
+        if (entry) {
+            _wheel_pm_unblock(clock);
+        }
+        return (ztimer_t *)entry;
+    }
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -403,14 +568,71 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_SLACK
+/* The clock may fire as late as the earliest target plus slack of all timers
+ * set, which handles all timers expiring until then in a single ISR. As the
+ * list is sorted, only timers expiring before that need to be looked at. */
+static uint32_t _slack_offset(const ztimer_clock_t *clock)
+{
+    const ztimer_base_t *entry = clock->list.next;
+    uint32_t target = entry->offset;
+    uint32_t latest = UINT32_MAX;
+
+    do {
+        uint32_t slack = ((const ztimer_t *)entry)->slack;
+        latest = _min_u32(latest, target + _min_u32(slack, UINT32_MAX - target));
+        entry = entry->next;
+        if (!entry) {
+            break;
+        }
+        target += entry->offset;
+    } while (target < latest);
+
+    return latest;
+}
+#endif
+
+/* offset of the next event from clock->list.offset, false if no timer is set */
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        uint32_t next;
+        if (!ztimer_wheel_next(clock->wheel, &next)) {
+            return false;
+        }
+        uint32_t lag = clock->list.offset - clock->wheel->base;
+        uint32_t ahead = next - clock->wheel->base;
+        *offset = (ahead > lag) ? ahead - lag : 0;
+        return true;
+    }
+#endif
+
+    if (!clock->list.next) {
+        return false;
+    }
+#if MODULE_ZTIMER_SLACK
+    *offset = _slack_offset(clock);
+#else
+    *offset = clock->list.next->offset;
+#endif
+    return true;
+}
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    if (clock->in_handler) {
+        /* ztimer_handler() arms the clock once all callbacks are done */
+        return;
+    }
+
+    uint32_t offset;
+    bool is_set = _next_offset(clock, &offset);
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (is_set) {
+            clock->ops->set(clock, _min_u32(offset, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -420,8 +642,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (is_set) {
+            clock->ops->set(clock, offset);
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -435,6 +657,24 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
 }
 
+#if MODULE_ZTIMER_OVERHEAD
+static void _record_latency(ztimer_clock_t *clock, uint32_t target)
+{
+    if (clock->latency) {
+        int32_t latency = (int32_t)(ztimer_now(clock) - target);
+        if (latency >= 0) {
+            ztimer_overhead_latency_add(clock->latency, latency);
+        }
+    }
+}
+#else
+static inline void _record_latency(ztimer_clock_t *clock, uint32_t target)
+{
+    (void)clock;
+    (void)target;
+}
+#endif
+
 void ztimer_handler(ztimer_clock_t *clock)
 {
     bool no_clock_user_left = false;
@@ -447,11 +687,11 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 #if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64
     if (IS_USED(MODULE_ZTIMER_NOW64) || clock->max_value < UINT32_MAX) {
-        /* calling now triggers checkpointing */
-        uint32_t now = ztimer_now(clock);
+        uint32_t now = _ztimer_checkpoint(clock);
+        uint32_t offset;
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_next_offset(clock, &offset)) {
+            uint32_t target = clock->list.offset + offset;
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -475,16 +715,55 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+    uint32_t offset;
+
+    if (_next_offset(clock, &offset)) {
+        _record_latency(clock, clock->list.offset + offset);
+
+#if MODULE_ZTIMER_WHEEL
+        if (clock->wheel) {
+            /* the event the clock was armed for may be gone (e.g. when the
+             * first timer was re-set to a later target), so catch up with
+             * the clock instead of jumping to the next event */
+            _ztimer_update_head_offset(clock);
+        }
+        else
+#endif
+        {
+            /* expire all timers up to the clock's target, with slack that
+             * may be more than the first one */
+            ztimer_base_t *base = clock->list.next;
+
+            clock->list.offset += offset;
+            while (base && (offset >= base->offset)) {
+                offset -= base->offset;
+                base->offset = 0;
+                base = base->next;
+            }
+            if (base) {
+                base->offset -= offset;
+            }
+        }
 
+#if MODULE_ZTIMER_SLACK
+        bool first = true;
+#endif
+        /* Run the callbacks of all expired timers in one batch. Timers they
+         * set or remove don't arm the clock, that is done once below. */
+        clock->in_handler = true;
         ztimer_t *entry = _now_next(clock);
         while (entry) {
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
             entry->callback(entry->arg);
+#if MODULE_ZTIMER_SLACK
+            /* every further timer expiring in this ISR saved a wakeup */
+            if (!first) {
+                clock->coalesced++;
+            }
+            first = false;
+#endif
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
             if (no_clock_user_left) {
@@ -499,6 +778,7 @@ void ztimer_handler(ztimer_clock_t *clock)
                 entry = _now_next(clock);
             }
         }
+        clock->in_handler = false;
     }
 
     /* only arm the clock if there are users left requiring the clock */
@@ -517,6 +797,17 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        printf("wheel at %" PRIu32 ":", clock->wheel->base);
+        for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+            printf(" %08" PRIx32, clock->wheel->pending[level]);
+        }
+        puts("");
+        return;
+    }
+#endif
+
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
@@ -531,6 +822,49 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     puts("");
 }
 
+#if MODULE_ZTIMER_WHEEL
+void ztimer_wheel_attach(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    unsigned state = irq_disable();
+    ztimer_base_t *entry = clock->list.next;
+
+    assert(!clock->wheel);
+
+    if (!entry) {
+        /* the wheel catches up with the clock once a timer is set */
+        ztimer_wheel_init(wheel, clock->list.offset);
+        clock->wheel = wheel;
+        irq_restore(state);
+        return;
+    }
+
+    /* move the timers over, their offsets become relative to now */
+    ztimer_wheel_init(wheel, _ztimer_update_head_offset(clock));
+    clock->list.next = NULL;
+    clock->last = NULL;
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+    if (clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->block_pm_mode);
+    }
+#endif
+    clock->wheel = wheel;
+
+    uint32_t offset = 0;
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+        offset += entry->offset;
+        entry->offset = offset;
+        entry->next = NULL;
+        entry->pprev = NULL;
+        _add_entry_to_list(clock, entry);
+        entry = next;
+    }
+
+    _ztimer_update(clock);
+    irq_restore(state);
+}
+#endif
+
 #if MODULE_ZTIMER_ONDEMAND && DEVELHELP
 void _ztimer_assert_clock_active(ztimer_clock_t *clock)
 {
@@ -259,6 +259,20 @@ ztimer_clock_t *const ZTIMER_SEC = ZTIMER_SEC_BASE;
 #  endif
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+#  include "ztimer/wheel.h"
+
+#  if MODULE_ZTIMER_USEC
+static ztimer_wheel_t _ztimer_wheel_usec;
+#  endif
+#  if MODULE_ZTIMER_MSEC
+static ztimer_wheel_t _ztimer_wheel_msec;
+#  endif
+#  if MODULE_ZTIMER_SEC
+static ztimer_wheel_t _ztimer_wheel_sec;
+#  endif
+#endif
+
 #if IS_USED(MODULE_ZTIMER_USEC)
 #ifndef CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL
 #define CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL     1000
@@ -417,4 +431,17 @@ void ztimer_init(void)
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
 #endif
+
+/* Step 6: move the timers of the ztimers requested into timer wheels */
+#if MODULE_ZTIMER_WHEEL
+#  if MODULE_ZTIMER_USEC
+    ztimer_wheel_attach(ZTIMER_USEC, &_ztimer_wheel_usec);
+#  endif
+#  if MODULE_ZTIMER_MSEC
+    ztimer_wheel_attach(ZTIMER_MSEC, &_ztimer_wheel_msec);
+#  endif
+#  if MODULE_ZTIMER_SEC
+    ztimer_wheel_attach(ZTIMER_SEC, &_ztimer_wheel_sec);
+#  endif
+#endif
 }
@@ -20,6 +20,13 @@
  * @}
  */
 
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
 #include "ztimer.h"
 #include "ztimer/overhead.h"
 
@@ -61,3 +68,51 @@ int32_t ztimer_overhead_sleep(ztimer_clock_t *clock, uint32_t base)
 
     return after - pre - base;
 }
+
+static_assert((CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS >= 2) &&
+              (CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS <= 33),
+              "CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS must be between 2 and 33");
+
+void ztimer_overhead_latency_attach(ztimer_clock_t *clock,
+                                    ztimer_overhead_latency_t *hist)
+{
+    unsigned state = irq_disable();
+
+    if (hist) {
+        memset(hist, 0, sizeof(*hist));
+    }
+    clock->latency = hist;
+    irq_restore(state);
+}
+
+void ztimer_overhead_latency_add(ztimer_overhead_latency_t *hist,
+                                 uint32_t ticks)
+{
+    unsigned bucket = 0;
+
+    if (ticks) {
+        /* bitarithm_msb() takes an unsigned, which may be 16 bit wide */
+        bucket = (ticks >> 16) ? 17 + bitarithm_msb(ticks >> 16)
+                               : 1 + bitarithm_msb(ticks);
+    }
+    if (bucket >= CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS) {
+        bucket = CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS - 1;
+    }
+    hist->count[bucket]++;
+}
+
+void ztimer_overhead_latency_print(const ztimer_overhead_latency_t *hist)
+{
+    for (unsigned i = 0; i < CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS; i++) {
+        uint32_t lower = i ? 1UL << (i - 1) : 0;
+
+        if (i == CONFIG_ZTIMER_OVERHEAD_LATENCY_BUCKETS - 1) {
+            printf("%5" PRIu32 "+       : %" PRIu32 "\n", lower, hist->count[i]);
+        }
+        else {
+            uint32_t upper = i ? (1UL << i) - 1 : 0;
+            printf("%5" PRIu32 " - %5" PRIu32 ": %" PRIu32 "\n",
+                   lower, upper, hist->count[i]);
+        }
+    }
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timer wheel implementation
+ *
+ * A timer is stored in the level of the most significant group of
+ * CONFIG_ZTIMER_WHEEL_BITS bits its target differs in from the time the wheel
+ * is at (the base), in the slot given by the target's bits of that group.
+ * Timers of level 0 thus expire exactly at the start of their slot, timers of
+ * higher levels within their slot. As long as the base only advances up to
+ * the next event, these placements stay valid without touching the timers.
+ *
+ * Timers that are at least a full top level slot away may share the top level
+ * slot of the base, they belong to the next revolution of the top level.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define BITS            CONFIG_ZTIMER_WHEEL_BITS
+#define MASK            (ZTIMER_WHEEL_SLOTS - 1)
+#define TOP             (ZTIMER_WHEEL_LEVELS - 1)
+#define SHIFT(level)    ((level) * BITS)
+
+static_assert((CONFIG_ZTIMER_WHEEL_BITS >= 1) && (CONFIG_ZTIMER_WHEEL_BITS <= 5),
+              "CONFIG_ZTIMER_WHEEL_BITS must be between 1 and 5");
+
+static unsigned _msb32(uint32_t v)
+{
+#if UINT_MAX >= UINT32_MAX
+    return bitarithm_msb(v);
+#else
+    return (v >> 16) ? 16 + bitarithm_msb(v >> 16) : bitarithm_msb(v);
+#endif
+}
+
+static unsigned _lsb32(uint32_t v)
+{
+#if UINT_MAX >= UINT32_MAX
+    return bitarithm_lsb(v);
+#else
+    return (v & 0xffff) ? bitarithm_lsb(v) : 16 + bitarithm_lsb(v >> 16);
+#endif
+}
+
+static unsigned _level(uint32_t base, uint32_t target)
+{
+    if ((target - base) >> SHIFT(TOP)) {
+        return TOP;
+    }
+
+    uint32_t diff = base ^ target;
+    return diff ? _msb32(diff) / BITS : 0;
+}
+
+static unsigned _slot(uint32_t target, unsigned level)
+{
+    return (target >> SHIFT(level)) & MASK;
+}
+
+/* time the slot of a level above 0 has to be cascaded */
+static uint32_t _slot_start(uint32_t base, unsigned level, unsigned slot)
+{
+    uint32_t start = (uint32_t)slot << SHIFT(level);
+
+    if (level < TOP) {
+        start |= (base >> SHIFT(level + 1)) << SHIFT(level + 1);
+    }
+    return start;
+}
+
+/* occupied slots of a level that come after the slot of the base */
+static uint32_t _later(const ztimer_wheel_t *wheel, unsigned level)
+{
+    unsigned cur = _slot(wheel->base, level);
+    /* level 0 includes the slot of the base, it holds the timers expiring
+     * right now */
+    uint32_t earlier = (level ? 2UL << cur : 1UL << cur) - 1;
+
+    return wheel->pending[level] & ~earlier;
+}
+
+static void _insert(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                    unsigned level, unsigned slot)
+{
+    ztimer_base_t **head = &wheel->slots[level][slot];
+
+    entry->next = *head;
+    if (entry->next) {
+        entry->next->pprev = &entry->next;
+    }
+    entry->pprev = head;
+    *head = entry;
+    wheel->pending[level] |= 1UL << slot;
+}
+
+static void _unlink(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                    unsigned level, unsigned slot)
+{
+    *entry->pprev = entry->next;
+    if (entry->next) {
+        entry->next->pprev = entry->pprev;
+    }
+    if (!wheel->slots[level][slot]) {
+        wheel->pending[level] &= ~(1UL << slot);
+    }
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+void ztimer_wheel_init(ztimer_wheel_t *wheel, uint32_t now)
+{
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->base = now;
+}
+
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel)
+{
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->pending[level]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ztimer_wheel_is_set(const ztimer_wheel_t *wheel,
+                         const ztimer_base_t *entry)
+{
+    /* timers that were removed or expired have no link */
+    if (!entry->pprev) {
+        return false;
+    }
+
+    /* if entry is stored in the wheel, its target is valid and maps to the
+     * slot holding it, otherwise entry->offset and entry->pprev may be
+     * anything, so only links stored in the wheel are followed */
+    unsigned level = _level(wheel->base, entry->offset);
+    ztimer_base_t *const *head = &wheel->slots[level][_slot(entry->offset, level)];
+
+    if (entry->pprev == head) {
+        return *head == entry;
+    }
+
+    const ztimer_base_t *tmp = *head;
+    while (tmp && (tmp != entry)) {
+        tmp = tmp->next;
+    }
+    return tmp != NULL;
+}
+
+bool ztimer_wheel_next(const ztimer_wheel_t *wheel, uint32_t *next)
+{
+    /* all timers of a level expire before those of the levels above */
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (!wheel->pending[level]) {
+            continue;
+        }
+
+        uint32_t later = _later(wheel, level);
+        if (!later) {
+            /* only the top level wraps around */
+            assert(level == TOP);
+            later = wheel->pending[level];
+        }
+
+        unsigned slot = _lsb32(later);
+        if (level == 0) {
+            *next = (wheel->base & ~(uint32_t)MASK) | slot;
+        }
+        else {
+            *next = _slot_start(wheel->base, level, slot);
+        }
+        return true;
+    }
+    return false;
+}
+
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                      uint32_t target)
+{
+    uint32_t next;
+    bool had_next = ztimer_wheel_next(wheel, &next);
+    unsigned level = _level(wheel->base, target);
+    unsigned slot = _slot(target, level);
+
+    entry->offset = target;
+    _insert(wheel, entry, level, slot);
+
+    DEBUG("ztimer_wheel_add(): %p at %" PRIu32 " into %u/%u\n",
+          (void *)entry, target, level, slot);
+
+    /* the timer's own event is its expiry or the cascade of its slot */
+    uint32_t event = level ? _slot_start(wheel->base, level, slot) : target;
+    return !had_next || ((event - wheel->base) < (next - wheel->base));
+}
+
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    unsigned level = _level(wheel->base, entry->offset);
+
+    assert(*entry->pprev == entry);
+    _unlink(wheel, entry, level, _slot(entry->offset, level));
+}
+
+static void _cascade(ztimer_wheel_t *wheel, uint32_t next)
+{
+    uint32_t old = wheel->base;
+
+    wheel->base = next;
+
+    /* cascade the slots reached, from the top down so that timers can move
+     * down several levels at once */
+    for (unsigned level = TOP; level > 0; level--) {
+        if (!(((old ^ next) >> SHIFT(level)) || ((next - old) >> SHIFT(level)))) {
+            continue;
+        }
+
+        unsigned slot = _slot(next, level);
+        ztimer_base_t *entry = wheel->slots[level][slot];
+
+        wheel->slots[level][slot] = NULL;
+        wheel->pending[level] &= ~(1UL << slot);
+        while (entry) {
+            ztimer_base_t *tmp = entry->next;
+            unsigned new_level = _level(next, entry->offset);
+
+            assert(new_level < level);
+            _insert(wheel, entry, new_level, _slot(entry->offset, new_level));
+            entry = tmp;
+        }
+    }
+}
+
+void ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now)
+{
+    uint32_t next;
+
+    while (ztimer_wheel_next(wheel, &next) &&
+           ((next - wheel->base) <= (now - wheel->base))) {
+        DEBUG("ztimer_wheel_advance(): %" PRIu32 " -> %" PRIu32 "\n",
+              wheel->base, next);
+        _cascade(wheel, next);
+        if (wheel->slots[0][_slot(next, 0)]) {
+            /* timers expire, stop here */
+            return;
+        }
+    }
+
+    /* no slot is reached, the timers keep their places */
+    wheel->base = now;
+}
+
+ztimer_base_t *ztimer_wheel_pop(ztimer_wheel_t *wheel)
+{
+    unsigned slot = _slot(wheel->base, 0);
+    ztimer_base_t *entry = wheel->slots[0][slot];
+
+    if (entry) {
+        assert(entry->offset == wheel->base);
+        _unlink(wheel, entry, 0, slot);
+    }
+    return entry;
+}
@@ -163,12 +163,33 @@ static int _del_entry_from_list(ztimer64_clock_t *clock, ztimer64_base_t *entry)
     }
 }
 
-uint64_t ztimer64_now(ztimer64_clock_t *clock)
+/* moves the checkpoint on if it lags behind, bumping the epoch so that
+ * concurrent readers in ztimer64_now() retry */
+static uint64_t _ztimer64_checkpoint(ztimer64_clock_t *clock)
 {
     uint64_t now;
     unsigned state = irq_disable();
     uint32_t base_now = ztimer_now(clock->base_clock);
 
+    if ((clock->checkpoint & ZTIMER64_CHECKPOINT_INTERVAL)
+        ^ (base_now & ZTIMER64_CHECKPOINT_INTERVAL)) {
+        clock->checkpoint += ZTIMER64_CHECKPOINT_INTERVAL;
+        clock->epoch++;
+    }
+
+    now = clock->checkpoint | base_now;
+
+    irq_restore(state);
+    return now;
+}
+
+uint64_t ztimer64_now(ztimer64_clock_t *clock)
+{
+    const volatile ztimer64_clock_t *vclock = clock;
+    uint64_t checkpoint;
+    uint32_t base_now;
+    uint16_t epoch;
+
     /* ztimer64 checkpointing works by storing
      * the upper 33 bits in clock->checkpoint.
      * The final time is the lower 32bit time ORed
@@ -181,16 +202,22 @@ uint64_t ztimer64_now(ztimer64_clock_t *clock)
      * This works as long as the checkpoint is at most (2**32-1) behind,
      * which is ensured by setting the base clock timer at most
      * ZTIMER64_CHECKPOINT_INTERVAL into the future.
+     *
+     * The checkpoint is only written with IRQs disabled, so it is read
+     * without disabling IRQs and read again if it was updated meanwhile.
      */
-    if ((clock->checkpoint & ZTIMER64_CHECKPOINT_INTERVAL)
+    do {
+        epoch = vclock->epoch;
+        checkpoint = vclock->checkpoint;
+        base_now = ztimer_now(clock->base_clock);
+    } while (vclock->epoch != epoch);
+
+    if ((checkpoint & ZTIMER64_CHECKPOINT_INTERVAL)
         ^ (base_now & ZTIMER64_CHECKPOINT_INTERVAL)) {
-        clock->checkpoint += ZTIMER64_CHECKPOINT_INTERVAL;
+        return _ztimer64_checkpoint(clock);
     }
 
-    now = clock->checkpoint | base_now;
-
-    irq_restore(state);
-    return now;
+    return checkpoint | base_now;
 }
 
 static void _ztimer64_update(ztimer64_clock_t *clock)
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark looking up UDP ports in the GNRC network registry
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "fmt.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define PORTS_NUMOF         (128U)
+#define PORT_BASE           (1024U)
+#define PORT_STRIDE         (17U)
+#define LOOKUPS             (100000U)
+
+static gnrc_netreg_entry_t _ports[PORTS_NUMOF];
+static gnrc_netreg_entry_t _all;
+static msg_t _msg_queue[4];
+static uint32_t _state = 1;
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, reproducible on all platforms */
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+/* looks up port as gnrc_netapi_dispatch() does and checks the result */
+static bool _lookup(uint32_t port, bool registered)
+{
+    unsigned numof = 0;
+    bool valid = true;
+
+    gnrc_netreg_acquire_shared();
+    for (gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port);
+         entry != NULL; entry = gnrc_netreg_getnext(entry)) {
+        if ((entry->demux_ctx != port) ||
+            (entry->target.pid != thread_getpid())) {
+            valid = false;
+        }
+        numof++;
+    }
+    gnrc_netreg_release_shared();
+
+    return valid && (numof == (registered ? 1U : 0U));
+}
+
+int main(void)
+{
+    bool valid = true;
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    gnrc_netreg_entry_init_pid(&_all, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_all);
+    for (unsigned i = 0; i < PORTS_NUMOF; i++) {
+        gnrc_netreg_entry_init_pid(&_ports[i], PORT_BASE + i * PORT_STRIDE,
+                                   thread_getpid());
+        if (gnrc_netreg_register(GNRC_NETTYPE_UDP, &_ports[i]) != 0) {
+            print_str("Registering port failed\n");
+            return 1;
+        }
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < LOOKUPS; i++) {
+        uint32_t r = _rand();
+        /* one in four ports is not registered */
+        bool registered = (r & 0x3) != 0;
+        uint32_t port = PORT_BASE + ((r >> 2) % PORTS_NUMOF) * PORT_STRIDE;
+
+        if (!_lookup(registered ? port : port + 1, registered)) {
+            valid = false;
+        }
+    }
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < PORTS_NUMOF; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_ports[i]);
+    }
+    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_all);
+
+    print_str("Verifying lookups: ");
+    print_str(valid ? "OK\n" : "FAIL\n");
+    print_u32_dec(PORTS_NUMOF);
+    print_str(" ports, ");
+    print_u32_dec(LOOKUPS);
+    print_str(" lookups, ");
+    print_u32_dec((uint64_t)usec * 1000 / LOOKUPS);
+    print_str(" ns/lookup\n");
+    if (valid) {
+        print_str("[SUCCESS]\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying lookups: OK\r\n")
+    child.expect(r"128 ports, [0-9]+ lookups, [0-9]+ ns/lookup\r\n")
+    child.expect_exact("[SUCCESS]\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark replaying a mixed packet trace against the GNRC
+ *              packet buffer
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "fmt.h"
+#include "net/gnrc/pktbuf.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB)
+#include "net/gnrc/pktbuf_slab.h"
+#endif
+
+#define STEPS               (100000U)
+#define INFLIGHT_NUMOF      (8U)
+
+#define FRAG_HDR_LEN        (4U)
+#define FRAG_MIN_LEN        (40U)
+#define FRAG_MAX_LEN        (127U)
+#define REASS_LEN           (1280U)
+#define UDP_HDR_LEN         (8U)
+#define IPV6_HDR_LEN        (40U)
+#define NETIF_HDR_LEN       (16U)
+#define CONTROL_LEN         (48U)
+
+typedef struct {
+    gnrc_pktsnip_t *pkt;        /* the whole packet */
+    gnrc_pktsnip_t *payload;    /* the snip that holds the pattern */
+    uint8_t seed;               /* first byte of the pattern */
+} _inflight_t;
+
+static _inflight_t _inflight[INFLIGHT_NUMOF];
+static uint32_t _state = 1;
+static unsigned _failed;
+static bool _corrupted;
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, reproducible on all platforms */
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static void _fill(gnrc_pktsnip_t *snip, uint8_t seed)
+{
+    uint8_t *data = snip->data;
+    for (size_t i = 0; i < snip->size; i++) {
+        data[i] = seed + i;
+    }
+}
+
+static void _release(_inflight_t *entry)
+{
+    const uint8_t *data = entry->payload->data;
+    for (size_t i = 0; i < entry->payload->size; i++) {
+        if (data[i] != (uint8_t)(entry->seed + i)) {
+            _corrupted = true;
+            break;
+        }
+    }
+    gnrc_pktbuf_release(entry->pkt);
+    entry->pkt = NULL;
+}
+
+static gnrc_pktsnip_t *_add(gnrc_pktsnip_t *next, size_t size)
+{
+    return gnrc_pktbuf_add(next, NULL, size, GNRC_NETTYPE_UNDEF);
+}
+
+/* a received 6LoWPAN fragment, its fragment header is marked */
+static bool _rx_fragment(_inflight_t *entry, uint8_t seed)
+{
+    size_t size = FRAG_MIN_LEN + (_rand() % (FRAG_MAX_LEN - FRAG_MIN_LEN + 1));
+    gnrc_pktsnip_t *pkt = _add(NULL, size);
+
+    if (pkt == NULL) {
+        return false;
+    }
+    _fill(pkt, seed);
+    if (gnrc_pktbuf_mark(pkt, FRAG_HDR_LEN, GNRC_NETTYPE_UNDEF) == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    entry->pkt = pkt;
+    entry->payload = pkt;
+    entry->seed = seed + FRAG_HDR_LEN;
+    return true;
+}
+
+/* a reassembly buffer for a full-MTU IPv6 packet */
+static bool _reassembly(_inflight_t *entry, uint8_t seed)
+{
+    gnrc_pktsnip_t *pkt = _add(NULL, REASS_LEN);
+
+    if (pkt == NULL) {
+        return false;
+    }
+    _fill(pkt, seed);
+    entry->pkt = pkt;
+    entry->payload = pkt;
+    entry->seed = seed;
+    return true;
+}
+
+/* an outgoing packet with the given payload length and headers */
+static bool _tx(_inflight_t *entry, uint8_t seed, size_t payload_len,
+                const uint8_t *hdr_lens, unsigned hdr_numof)
+{
+    gnrc_pktsnip_t *payload = _add(NULL, payload_len);
+    gnrc_pktsnip_t *pkt = payload;
+
+    if (payload == NULL) {
+        return false;
+    }
+    _fill(payload, seed);
+    for (unsigned i = 0; i < hdr_numof; i++) {
+        gnrc_pktsnip_t *hdr = _add(pkt, hdr_lens[i]);
+        if (hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+            return false;
+        }
+        pkt = hdr;
+    }
+    entry->pkt = pkt;
+    entry->payload = payload;
+    entry->seed = seed;
+    return true;
+}
+
+static void _step(unsigned step)
+{
+    static const uint8_t full_hdrs[] = { UDP_HDR_LEN, IPV6_HDR_LEN, NETIF_HDR_LEN };
+    static const uint8_t control_hdrs[] = { IPV6_HDR_LEN };
+    _inflight_t *entry = &_inflight[_rand() % INFLIGHT_NUMOF];
+    unsigned kind = _rand() % 10;
+    bool success;
+
+    if (entry->pkt) {
+        _release(entry);
+    }
+    if (kind < 6) {
+        success = ((step % 8) == 0) ? _reassembly(entry, step)
+                                    : _rx_fragment(entry, step);
+    }
+    else if (kind < 8) {
+        success = _tx(entry, step, REASS_LEN - UDP_HDR_LEN - IPV6_HDR_LEN,
+                      full_hdrs, ARRAY_SIZE(full_hdrs));
+    }
+    else {
+        success = _tx(entry, step, CONTROL_LEN, control_hdrs,
+                      ARRAY_SIZE(control_hdrs));
+    }
+    if (!success) {
+        _failed++;
+    }
+}
+
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB)
+static void _print_slab_stats(void)
+{
+    static const char *names[] = { "snips", "small", "medium", "large" };
+    gnrc_pktbuf_slab_class_stats_t stats[GNRC_PKTBUF_SLAB_CLASS_NUMOF];
+
+    gnrc_pktbuf_slab_get_stats(stats);
+    for (unsigned i = 0; i < ARRAY_SIZE(stats); i++) {
+        print_str(names[i]);
+        print_str(": ");
+        print_u32_dec(stats[i].numof);
+        print_str(" x ");
+        print_u32_dec(stats[i].size);
+        print_str(" bytes, max used ");
+        print_u32_dec(stats[i].max_used);
+        print_str(", fallbacks ");
+        print_u32_dec(stats[i].fallbacks);
+        print_str(", fails ");
+        print_u32_dec(stats[i].fails);
+        print_str("\n");
+    }
+}
+#endif
+
+int main(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned step = 0; step < STEPS; step++) {
+        _step(step);
+    }
+    for (unsigned i = 0; i < INFLIGHT_NUMOF; i++) {
+        if (_inflight[i].pkt) {
+            _release(&_inflight[i]);
+        }
+    }
+    uint32_t usec = ztimer_now(ZTIMER_USEC) - start;
+
+    print_str("Verifying payloads: ");
+    print_str(_corrupted ? "FAIL\n" : "OK\n");
+    print_u32_dec(STEPS);
+    print_str(" packets, ");
+    print_u32_dec(_failed);
+    print_str(" failed, ");
+    print_u32_dec((uint64_t)usec * 1000 / STEPS);
+    print_str(" ns/packet\n");
+#if IS_USED(MODULE_GNRC_PKTBUF_SLAB)
+    _print_slab_stats();
+#endif
+    if (!_corrupted) {
+        print_str("[SUCCESS]\n");
+    }
+
+    return 0;
+}
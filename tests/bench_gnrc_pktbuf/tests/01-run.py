@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying payloads: OK\r\n")
+    child.expect(r"[0-9]+ packets, [0-9]+ failed, [0-9]+ ns/packet\r\n")
+    child.expect_exact("[SUCCESS]\r\n")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
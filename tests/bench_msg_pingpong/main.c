@@ -32,7 +32,19 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#ifndef BATCH_DURATION_US
+#define BATCH_DURATION_US   (TEST_DURATION_US / 4)
+#endif
+
+/* batch sizes 1, 2, 4, ... up to BATCH_MAX are measured */
+#define BATCH_MAX           (32U)
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _batch_stack[THREAD_STACKSIZE_MAIN];
+
+static msg_t _batch_queue[BATCH_MAX];
+static msg_t _batch_rx[BATCH_MAX];
+static msg_t _batch_tx[BATCH_MAX];
 
 static void _timer_callback(void *flag)
 {
@@ -51,6 +63,43 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_batch_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_batch_queue, BATCH_MAX);
+    while (1) {
+        msg_receive_batch(_batch_rx, BATCH_MAX);
+    }
+
+    return NULL;
+}
+
+/*
+ * The receiver drains its queue with msg_receive_batch(), so a batch of
+ * messages costs two context switches no matter its size.
+ */
+static void _batch_bench(kernel_pid_t other, unsigned batch)
+{
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t n = 0;
+
+    xtimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    atomic_flag_test_and_set(&flag);
+    xtimer_set(&timer, BATCH_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        n += msg_send_batch(_batch_tx, batch, other);
+    }
+
+    printf("{ \"batch\" : %u, \"msgs_per_sec\" : %" PRIu32 " }\n", batch,
+           (uint32_t)(((uint64_t)n * US_PER_SEC) / BATCH_DURATION_US));
+}
+
 int main(void)
 {
     puts("main starting");
@@ -85,5 +134,17 @@ int main(void)
            (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
     puts(" }");
 
+    kernel_pid_t batch_other = thread_create(_batch_stack,
+                                             sizeof(_batch_stack),
+                                             (THREAD_PRIORITY_MAIN - 1),
+                                             THREAD_CREATE_STACKTEST,
+                                             _batch_thread,
+                                             NULL,
+                                             "batch_thread");
+
+    for (unsigned batch = 1; batch <= BATCH_MAX; batch *= 2) {
+        _batch_bench(batch_other, batch);
+    }
+
     return 0;
 }
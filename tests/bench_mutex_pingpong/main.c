@@ -30,10 +30,22 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef HANDOFF_HOLD
+#define HANDOFF_HOLD        (300U)
+#endif
+
+#ifndef HANDOFF_SAMPLES
+#define HANDOFF_SAMPLES     (128U)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 static mutex_t _mutex = MUTEX_INIT;
 
+static mutex_t _handoff = MUTEX_INIT;
+static volatile uint32_t _released;
+static uint16_t _latency[HANDOFF_SAMPLES];
+
 static void _timer_callback(void*arg)
 {
     (void)arg;
@@ -41,6 +53,59 @@ static void _timer_callback(void*arg)
     _flag = 1;
 }
 
+static void _release_callback(void *arg)
+{
+    (void)arg;
+
+    _released = xtimer_now_usec();
+    mutex_unlock(&_handoff);
+}
+
+static unsigned _percentile(unsigned p)
+{
+    return _latency[(HANDOFF_SAMPLES - 1) * p / 100];
+}
+
+/*
+ * main waits for a mutex released by a timer ISR HANDOFF_HOLD microseconds
+ * later, like for the completion of a short hardware operation. The latency
+ * is the time from the release to main holding the mutex.
+ */
+static void _handoff_bench(const char *name, mutex_spin_t *spin)
+{
+    xtimer_t timer = { .callback = _release_callback };
+
+    for (unsigned i = 0; i < HANDOFF_SAMPLES; i++) {
+        mutex_lock(&_handoff);
+        xtimer_set(&timer, HANDOFF_HOLD);
+        if (spin) {
+            mutex_lock_adaptive(&_handoff, spin);
+        }
+        else {
+            mutex_lock(&_handoff);
+        }
+        _latency[i] = xtimer_now_usec() - _released;
+        mutex_unlock(&_handoff);
+    }
+
+    /* insertion sort, the samples are few */
+    for (unsigned i = 1; i < HANDOFF_SAMPLES; i++) {
+        uint16_t val = _latency[i];
+        unsigned j = i;
+        for (; (j > 0) && (_latency[j - 1] > val); j--) {
+            _latency[j] = _latency[j - 1];
+        }
+        _latency[j] = val;
+    }
+
+    printf("{ \"handoff\" : \"%s\", \"switches_avoided\" : %u"
+           ", \"blocked\" : %u", name, spin ? 2 * spin->spun : 0,
+           spin ? spin->blocked : HANDOFF_SAMPLES);
+    printf(", \"p50\" : %u, \"p90\" : %u, \"p99\" : %u, \"max\" : %u }\n",
+           _percentile(50), _percentile(90), _percentile(99),
+           _percentile(100));
+}
+
 static void *_second_thread(void *arg)
 {
     (void)arg;
@@ -84,5 +149,9 @@ int main(void)
            (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
     puts(" }");
 
+    mutex_spin_t spin = MUTEX_SPIN_INIT;
+    _handoff_bench("blocking", NULL);
+    _handoff_bench("adaptive", &spin);
+
     return 0;
 }
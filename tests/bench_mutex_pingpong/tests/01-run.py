@@ -10,9 +10,14 @@
 import sys
 from testrunner import run
 
+HANDOFF = (r"{ \"handoff\" : \"%s\", \"switches_avoided\" : \d+, \"blocked\" : \d+"
+           r", \"p50\" : \d+, \"p90\" : \d+, \"p99\" : \d+, \"max\" : \d+ }")
+
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(HANDOFF % "blocking")
+    child.expect(HANDOFF % "adaptive")
 
 
 if __name__ == "__main__":
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the thread-safe ringbuffer
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "tsrb.h"
+#include "ztimer.h"
+
+#define BUF_SIZE        (256U)
+#define BENCH_BYTES     (64U * 1024U)
+/* keeps the chunks from being aligned to the end of the buffer */
+#define OFFSET          (3U)
+
+static uint8_t _buf[BUF_SIZE];
+static tsrb_t _rb = TSRB_INIT(_buf);
+
+static uint8_t _in[64];
+static uint8_t _out[64];
+
+static void _reset(void)
+{
+    tsrb_init(&_rb, _buf, sizeof(_buf));
+    for (unsigned i = 0; i < OFFSET; i++) {
+        tsrb_add_one(&_rb, 0);
+    }
+}
+
+static void _print_result(unsigned size, const char *funcs, uint32_t usec)
+{
+    print_u32_dec(size);
+    print_str(size == 1 ? " byte, " : " bytes, ");
+    print_str(funcs);
+    print_str(": ");
+    print_u32_dec((uint64_t)usec * 1000 / BENCH_BYTES);
+    print_str(" ns/byte\n");
+}
+
+static int _verify(void)
+{
+    _reset();
+    tsrb_drop(&_rb, OFFSET);
+    for (unsigned round = 0; round < 2 * BUF_SIZE; round++) {
+        unsigned size = 1 + (round % sizeof(_in));
+        for (unsigned i = 0; i < size; i++) {
+            _in[i] = round + i;
+        }
+        if ((tsrb_add(&_rb, _in, size) != (int)size) ||
+            (tsrb_get(&_rb, _out, sizeof(_out)) != (int)size) ||
+            memcmp(_in, _out, size)) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    uint32_t start;
+
+    print_str("Verifying tsrb: ");
+    print_str(_verify() ? "FAIL\n" : "OK\n");
+
+    _reset();
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_BYTES; i++) {
+        tsrb_add_one(&_rb, i);
+        tsrb_get_one(&_rb);
+    }
+    _print_result(1, "tsrb_add_one() + tsrb_get_one()",
+                  ztimer_now(ZTIMER_USEC) - start);
+
+    for (unsigned size = 4; size <= sizeof(_in); size *= 4) {
+        _reset();
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < BENCH_BYTES / size; i++) {
+            tsrb_add(&_rb, _in, size);
+            tsrb_get(&_rb, _out, size);
+        }
+        _print_result(size, "tsrb_add() + tsrb_get()",
+                      ztimer_now(ZTIMER_USEC) - start);
+    }
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Verifying tsrb: OK\r\n")
+    child.expect(r"1 byte, tsrb_add_one\(\) \+ tsrb_get_one\(\): [0-9]+ ns/byte\r\n")
+    for size in (4, 16, 64):
+        child.expect(r"{} bytes, tsrb_add\(\) \+ tsrb_get\(\): [0-9]+ ns/byte\r\n"
+                     .format(size))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -54,9 +54,11 @@ int main(void)
 {
     printf("main starting\n");
 
+    /* share main's priority, which differs from THREAD_PRIORITY_MAIN when
+     * a scheduler module moved it */
     thread_create(_stack,
                   sizeof(_stack),
-                  THREAD_PRIORITY_MAIN,
+                  thread_get_active()->priority,
                   THREAD_CREATE_STACKTEST,
                   _second_thread,
                   NULL,
@@ -241,6 +241,11 @@ extern "C" {
 /* estimate_cpu_overhead will loop for this many iterations to get a proper estimate */
 #define ESTIMATE_CPU_ITERATIONS 2048
 
+/* bench_clock_read will read the clocks this many times */
+#ifndef CLOCK_READ_ITERATIONS
+#define CLOCK_READ_ITERATIONS 10000
+#endif
+
 #if TEST_XTIMER
 #define READ_TUT() _xtimer_now()
 #else
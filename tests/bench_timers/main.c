@@ -35,6 +35,10 @@
 #if TEST_XTIMER
 #include "xtimer.h"
 #endif
+#if TEST_ZTIMER_NOW
+#include "ztimer.h"
+#include "ztimer64.h"
+#endif
 
 #include "board.h"
 #include "cpu.h"
@@ -598,9 +602,60 @@ static void estimate_cpu_overhead(void)
     }
 }
 
+#if TEST_ZTIMER_NOW
+/* Keeps the benchmark loops from being optimized away */
+static volatile uint32_t clock_read_sink;
+
+static void print_ns_per_read(const char *name, uint32_t elapsed, uint32_t empty)
+{
+    print_str(name);
+    print_str(": ");
+    if (elapsed < empty) {
+        elapsed = empty;
+    }
+    print_u32_dec((elapsed - empty) * 1000 / CLOCK_READ_ITERATIONS);
+    print_str(" ns per call\n");
+}
+
+static void bench_clock_read(void)
+{
+    /* ztimer_now() and ztimer64_now() are timed by ZTIMER_USEC itself, the
+     * cost of the loop is subtracted */
+    print_str("Benchmarking clock reads, ");
+    print_u32_dec(CLOCK_READ_ITERATIONS);
+    print_str(" iterations...\n");
+
+    uint32_t begin = ztimer_now(ZTIMER_USEC);
+    for (unsigned int k = 0; k < CLOCK_READ_ITERATIONS; ++k) {
+        clock_read_sink = k;
+    }
+    uint32_t empty = ztimer_now(ZTIMER_USEC) - begin;
+
+    begin = ztimer_now(ZTIMER_USEC);
+    for (unsigned int k = 0; k < CLOCK_READ_ITERATIONS; ++k) {
+        clock_read_sink = ztimer_now(ZTIMER_USEC);
+    }
+    print_ns_per_read("ztimer_now(ZTIMER_USEC)",
+                      ztimer_now(ZTIMER_USEC) - begin, empty);
+
+    begin = ztimer_now(ZTIMER_USEC);
+    for (unsigned int k = 0; k < CLOCK_READ_ITERATIONS; ++k) {
+        clock_read_sink = (uint32_t)ztimer64_now(ZTIMER64_USEC);
+    }
+    print_ns_per_read("ztimer64_now(ZTIMER64_USEC)",
+                      ztimer_now(ZTIMER_USEC) - begin, empty);
+}
+#endif /* TEST_ZTIMER_NOW */
+
 int main(void)
 {
     print_str("\nStatistical benchmark for timers\n");
+#if TEST_ZTIMER_NOW
+    /* ztimer owns the timers, so only the clock reads are benchmarked */
+    bench_clock_read();
+    print_str("Done.\n");
+    return 0;
+#endif
     for (unsigned int k = 0; k < ARRAY_SIZE(ref_states); ++k) {
         matstat_clear(&ref_states[k]);
     }
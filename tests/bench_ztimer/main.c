@@ -22,9 +22,11 @@
 
 #include "test_utils/expect.h"
 
+#include "container.h"
 #include "msg.h"
 #include "thread.h"
 #include "ztimer.h"
+#include "ztimer/convert_frac.h"
 
 #ifndef ZTIMER
 #define ZTIMER ZTIMER_MSEC
@@ -46,7 +48,25 @@
 #define SPREAD  (10LU)
 #endif
 
-static ztimer_t _timers[NUMOF_TIMERS];
+/* largest number of timers armed by the scaling benchmark */
+#ifndef SCALE_TIMERS
+#define SCALE_TIMERS    NUMOF_TIMERS
+#endif
+
+#if SCALE_TIMERS > NUMOF_TIMERS
+#define TIMERS_MAX      SCALE_TIMERS
+#else
+#define TIMERS_MAX      NUMOF_TIMERS
+#endif
+
+static ztimer_t _timers[TIMERS_MAX];
+
+static const unsigned _scale_steps[] = { 1000, 2000, 5000, 10000 };
+
+/* converters on top of ZTIMER_USEC, to 1 kHz (precomputed unless
+ * CONFIG_ZTIMER_CONVERT_FRAC_CONST is 0) and to 1024 Hz (always computed) */
+static ztimer_convert_frac_t _conv_const;
+static ztimer_convert_frac_t _conv_frac;
 
 /* This variable is set by any timer that actually triggers.  As the test is
  * only testing set/remove/now operations, timers are not supposed to trigger.
@@ -91,6 +111,63 @@ static void _print_result(const char *desc, unsigned n, uint32_t total)
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+/* position of timer 'n' out of 'numof', scattered over the whole range */
+static unsigned _scatter(unsigned n, unsigned numof)
+{
+    /* 7919 is prime and thus coprime to all step sizes */
+    return ((unsigned long)n * 7919) % numof;
+}
+
+static uint32_t _bench_convert_frac_init(ztimer_convert_frac_t *conv,
+                                         uint32_t freq)
+{
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        ztimer_convert_frac_init(conv, ZTIMER_USEC, freq, 1000000LU);
+        /* drop the extension timer before the next init overwrites it */
+        ztimer_remove(ZTIMER_USEC, &conv->super.lower_entry);
+    }
+    return ztimer_now(ZTIMER_USEC) - before;
+}
+
+static uint32_t _bench_convert_frac_now(ztimer_convert_frac_t *conv)
+{
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        ztimer_now(&conv->super.super);
+    }
+    return ztimer_now(ZTIMER_USEC) - before;
+}
+
+/* arm 'numof' timers with scattered targets, then remove them in a different
+ * scattered order */
+static void _bench_scale(unsigned numof)
+{
+    char desc[32];
+    uint32_t before, diff;
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < numof; n++) {
+        _timer_set(_scatter(n, numof));
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    snprintf(desc, sizeof(desc), "set() %u scattered", numof);
+    _print_result(desc, numof, diff);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < numof; n++) {
+        _timer_remove(_scatter(numof - n - 1, numof));
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    snprintf(desc, sizeof(desc), "remove() %u scattered", numof);
+    _print_result(desc, numof, diff);
+    expect(!_triggers);
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
@@ -99,7 +176,7 @@ int main(void)
     uint32_t before, diff, start;
 
     /* initializing timer structs */
-    for (unsigned int n = 0; n < NUMOF_TIMERS; n++) {
+    for (unsigned int n = 0; n < TIMERS_MAX; n++) {
         _timers[n].callback = _callback;
         _timers[n].arg = &_triggers;
     }
@@ -288,7 +365,46 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
-    _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
+    /*
+     * test convert_frac setup and ztimer_now() with precomputed and
+     * computed fractions
+     *
+     */
+    diff = _bench_convert_frac_init(&_conv_const, 1000LU);
+    _print_result("frac init() + remove() 1kHz", REPEAT, diff);
+    diff = _bench_convert_frac_init(&_conv_frac, 1024LU);
+    _print_result("frac init() + remove() 1024Hz", REPEAT, diff);
+
+    ztimer_convert_frac_init(&_conv_const, ZTIMER_USEC, 1000LU, 1000000LU);
+    ztimer_convert_frac_init(&_conv_frac, ZTIMER_USEC, 1024LU, 1000000LU);
+    diff = _bench_convert_frac_now(&_conv_const);
+    _print_result("ztimer_now() frac 1kHz", REPEAT, diff);
+    diff = _bench_convert_frac_now(&_conv_frac);
+    _print_result("ztimer_now() frac 1024Hz", REPEAT, diff);
+    ztimer_remove(ZTIMER_USEC, &_conv_const.super.lower_entry);
+    ztimer_remove(ZTIMER_USEC, &_conv_frac.super.lower_entry);
+    expect(!_triggers);
+
+    /*
+     * test setting / removing increasing numbers of timers with scattered
+     * targets
+     *
+     */
+    _base = BASE;
+    unsigned scaled = 0;
+    for (unsigned i = 0; i < ARRAY_SIZE(_scale_steps); i++) {
+        if (_scale_steps[i] > SCALE_TIMERS) {
+            break;
+        }
+        _bench_scale(_scale_steps[i]);
+        scaled = _scale_steps[i];
+    }
+    if (scaled < SCALE_TIMERS) {
+        _bench_scale(SCALE_TIMERS);
+    }
+
+    _print_result("sizeof(ztimer_t)", NUMOF_TIMERS,
+                  NUMOF_TIMERS * sizeof(ztimer_t));
 
     puts("done.");
 
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Event queue statistics test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "container.h"
+#include "event.h"
+#include "event/stats.h"
+#include "event/thread.h"
+#include "event/timeout.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define WAIT_US         (1000U)
+#define DELAY_MS        (10U)
+
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+    _handled++;
+}
+
+static event_t _events[4] = {
+    { .handler = _handler },
+    { .handler = _handler },
+    { .handler = _handler },
+    { .handler = _handler },
+};
+
+static event_t _thread_event = { .handler = _handler };
+
+static event_queue_t _queue;
+static event_queue_stats_t _stats;
+static event_queue_t _late_queue;
+static event_queue_stats_t _late_stats;
+static event_timeout_t _timeout;
+
+int main(void)
+{
+    event_t *event;
+
+    event_queue_init(&_queue);
+    event_queue_stats_attach(&_queue, &_stats);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_events); i++) {
+        event_post(&_queue, &_events[i]);
+    }
+    /* already queued, must not be counted again */
+    event_post(&_queue, &_events[0]);
+    expect(_stats.posted == 4);
+    expect(_stats.depth == 4);
+
+    event_cancel(&_queue, &_events[3]);
+    expect(_stats.depth == 3);
+
+    ztimer_sleep(ZTIMER_USEC, WAIT_US);
+    while ((event = event_get(&_queue))) {
+        event->handler(event);
+    }
+    expect(_handled == 3);
+    expect(_stats.handled == 3);
+    expect(_stats.max_latency >= WAIT_US);
+
+    /* delayed work enters the queue when the timeout expires */
+    event_timeout_ztimer_init(&_timeout, ZTIMER_MSEC, &_queue, &_events[0]);
+    event_timeout_set(&_timeout, DELAY_MS);
+    expect(_stats.depth == 0);
+    event = event_wait(&_queue);
+    event->handler(event);
+    expect(_stats.handled == 4);
+
+    puts("own queue:");
+    event_queue_stats_print(&_stats);
+
+    /* events queued before the statistics are attached wait from then on */
+    event_queue_init(&_late_queue);
+    event_post(&_late_queue, &_events[1]);
+    event_post(&_late_queue, &_events[2]);
+    ztimer_sleep(ZTIMER_MSEC, DELAY_MS);
+    event_queue_stats_attach(&_late_queue, &_late_stats);
+    expect(_late_stats.posted == 2);
+    expect(_late_stats.depth == 2);
+    event_post(&_late_queue, &_events[3]);
+    while ((event = event_get(&_late_queue))) {
+        event->handler(event);
+    }
+    expect(_late_stats.handled == 3);
+    expect(_late_stats.depth == 0);
+    expect(_late_stats.max_depth == 3);
+    expect(_late_stats.max_latency < DELAY_MS * US_PER_MS);
+    event_queue_stats_attach(&_late_queue, NULL);
+
+    /* the event thread has a higher priority and preempts main */
+    event_post(EVENT_PRIO_MEDIUM, &_thread_event);
+    expect(_handled == 8);
+
+    puts("event thread queue:");
+    event_queue_stats_print(&event_thread_stats[EVENT_QUEUE_PRIO_MEDIUM]);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
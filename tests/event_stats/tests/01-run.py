@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact('own queue:\r\n')
+    child.expect(r'posted: 5, handled: 4, depth: 0, max depth: 4, '
+                 r'max latency: \d+ us\r\n')
+    child.expect_exact('event thread queue:\r\n')
+    child.expect(r'posted: 1, handled: 1, depth: 0, max depth: 1, '
+                 r'max latency: \d+ us\r\n')
+    child.expect_exact('[SUCCESS]\r\n')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -28,6 +28,7 @@
 #include "event.h"
 #include "event/timeout.h"
 #include "event/callback.h"
+#include "event/counted.h"
 #if IS_USED(MODULE_ZTIMER_USEC)
 #include "ztimer.h"
 #else
@@ -83,10 +84,34 @@ static void custom_callback(event_t *event)
     printf("triggered custom event with text: \"%s\"\n", custom_event->text);
 }
 
-static void timed_callback(void *arg)
+static void counted_callback(event_counted_t *event, uint32_t value);
+static void masked_callback(event_counted_t *event, uint32_t value);
+
+static event_counted_t counted_event = EVENT_COUNTED_INIT(counted_callback);
+static event_counted_t masked_event = EVENT_COUNTED_INIT(masked_callback);
+
+static void counted_callback(event_counted_t *event, uint32_t value)
 {
     order++;
     expect(order == 6);
+    expect(event == &counted_event);
+    expect(value == 3);
+    printf("triggered counted event, posted %" PRIu32 " times\n", value);
+}
+
+static void masked_callback(event_counted_t *event, uint32_t value)
+{
+    order++;
+    expect(order == 7);
+    expect(event == &masked_event);
+    expect(value == 0x81);
+    printf("triggered masked event with mask 0x%02" PRIx32 "\n", value);
+}
+
+static void timed_callback(void *arg)
+{
+    order++;
+    expect(order == 8);
     expect(arg == event_callback_ptr->arg);
 #if IS_USED(MODULE_ZTIMER_USEC)
     uint32_t now = ztimer_now(ZTIMER_USEC);
@@ -187,6 +212,16 @@ int main(void)
     puts("posting custom event");
     event_post(&queue, (event_t *)&custom_event);
 
+    puts("posting counted event 3 times");
+    for (unsigned i = 0; i < 3; i++) {
+        event_counted_post(&queue, &counted_event);
+    }
+
+    puts("posting masked event with masks 0x01, 0x80 and 0x01");
+    event_counted_post_mask(&queue, &masked_event, 0x01);
+    event_counted_post_mask(&queue, &masked_event, 0x80);
+    event_counted_post_mask(&queue, &masked_event, 0x01);
+
     event_timeout_t event_timeout;
 
     puts("posting timed callback with timeout 1sec");
@@ -20,6 +20,7 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 #include "byteorder.h"
@@ -112,10 +113,23 @@ int main(void)
 
 static void _recv(netdev_t *dev)
 {
+    /* receive every second frame without querying its length first */
+    static bool one_pass;
     netdev_ieee802154_rx_info_t rx_info;
-    const int exp_len = dev->driver->recv(dev, NULL, 0, NULL);
+    netopt_enable_t enable = NETOPT_DISABLE;
+    int exp_len;
     int data_len;
 
+    dev->driver->get(dev, NETOPT_RX_ONE_PASS, &enable, sizeof(enable));
+    if (one_pass && (enable == NETOPT_ENABLE)) {
+        puts("Receiving in one pass");
+        exp_len = sizeof(_recvbuf);
+    }
+    else {
+        exp_len = dev->driver->recv(dev, NULL, 0, NULL);
+    }
+    one_pass = !one_pass;
+
     expect(exp_len >= 0);
     expect(((unsigned)exp_len) <= sizeof(_recvbuf));
     data_len = dev->driver->recv(dev, _recvbuf, exp_len, &rx_info);
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ * @file
+ * @brief       Test sys/msg_payload
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "msg_payload.h"
+#include "thread.h"
+
+#define FRAME_SIZE      (48U)
+#define POOL_NUMOF      (4U)
+#define FRAMES          (32U)
+#define CONSUMERS       (2U)
+#define MSG_TYPE_FRAME  (0x4652)
+
+static char stacks[CONSUMERS][THREAD_STACKSIZE_DEFAULT];
+
+static MSG_PAYLOAD_POOL_BUF(pool_buf, FRAME_SIZE, POOL_NUMOF);
+static msg_payload_pool_t pool;
+
+static volatile unsigned received;
+static volatile unsigned corrupted;
+
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    while (1) {
+        msg_receive(&msg);
+        msg_payload_t *frame = msg_payload_get(&msg, MSG_TYPE_FRAME);
+        if (!frame) {
+            continue;
+        }
+
+        const uint8_t *data = msg_payload_data(frame);
+        for (unsigned i = 0; i < frame->len; i++) {
+            if (data[i] != (uint8_t)(data[0] + i)) {
+                corrupted++;
+                break;
+            }
+        }
+        received++;
+        msg_payload_release(frame);
+    }
+    return NULL;
+}
+
+static bool _test_exhaustion(void)
+{
+    msg_payload_t *frames[POOL_NUMOF];
+
+    if (msg_payload_alloc(&pool, FRAME_SIZE + 1)) {
+        puts("allocated a buffer larger than the pool's");
+        return false;
+    }
+    for (unsigned i = 0; i < POOL_NUMOF; i++) {
+        frames[i] = msg_payload_alloc(&pool, FRAME_SIZE);
+        if (!frames[i]) {
+            puts("pool exhausted early");
+            return false;
+        }
+    }
+    if (msg_payload_alloc(&pool, FRAME_SIZE)) {
+        puts("allocated from an exhausted pool");
+        return false;
+    }
+    for (unsigned i = 0; i < POOL_NUMOF; i++) {
+        msg_payload_release(frames[i]);
+    }
+    return msg_payload_pool_available(&pool) == POOL_NUMOF;
+}
+
+static bool _test_drop(void)
+{
+    msg_t msg;
+    msg_payload_t *frame = msg_payload_alloc(&pool, FRAME_SIZE);
+
+    /* main has no message queue, so sending to itself can not succeed */
+    if (msg_payload_try_send(&msg, MSG_TYPE_FRAME, frame, thread_getpid())) {
+        puts("message to self was delivered");
+        return false;
+    }
+    return msg_payload_pool_available(&pool) == POOL_NUMOF;
+}
+
+int main(void)
+{
+    kernel_pid_t consumers[CONSUMERS];
+    bool failed = false;
+
+    msg_payload_pool_init(&pool, pool_buf, FRAME_SIZE, POOL_NUMOF);
+
+    if (_test_exhaustion()) {
+        puts("exhaustion: ok");
+    }
+    else {
+        failed = true;
+    }
+
+    for (unsigned i = 0; i < CONSUMERS; i++) {
+        consumers[i] = thread_create(stacks[i], sizeof(stacks[i]),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST,
+                                     _consumer, NULL, "consumer");
+    }
+
+    unsigned frames = 0;
+    for (unsigned n = 0; n < FRAMES; n++) {
+        msg_payload_t *frame = msg_payload_alloc(&pool, FRAME_SIZE - (n % 8));
+        if (!frame) {
+            puts("pool exhausted");
+            failed = true;
+            break;
+        }
+
+        uint8_t *data = msg_payload_data(frame);
+        for (unsigned i = 0; i < frame->len; i++) {
+            data[i] = n + i;
+        }
+
+        /* one reference per message, the first one is taken by alloc */
+        for (unsigned i = 1; i < CONSUMERS; i++) {
+            msg_payload_hold(frame);
+        }
+        for (unsigned i = 0; i < CONSUMERS; i++) {
+            msg_t msg;
+            msg_payload_send(&msg, MSG_TYPE_FRAME, frame, consumers[i]);
+        }
+        frames++;
+    }
+
+    printf("frames: %u, received: %u, corrupted: %u\n",
+           frames, received, corrupted);
+    if ((received != FRAMES * CONSUMERS) || corrupted ||
+        (msg_payload_pool_available(&pool) != POOL_NUMOF)) {
+        failed = true;
+    }
+
+    if (_test_drop()) {
+        puts("dropped: ok");
+    }
+    else {
+        failed = true;
+    }
+
+    puts(failed ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
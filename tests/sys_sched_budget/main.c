@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ * @file
+ * @brief       Test sys/sched_budget
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "sched_budget.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define BUDGET      (20U * US_PER_MS)
+#define PERIOD      (100U * US_PER_MS)
+#define PERIODS     (10U)
+
+static char stack[THREAD_STACKSIZE_DEFAULT];
+
+static volatile uint32_t loops;
+
+static void *_busy(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        loops++;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    static const thread_attr_t attr = {
+        .budget = BUDGET,
+        .period = PERIOD,
+    };
+
+    puts("starting busy thread");
+    kernel_pid_t pid = thread_create_ext(stack, sizeof(stack),
+                                         THREAD_PRIORITY_MAIN - 1,
+                                         THREAD_CREATE_STACKTEST,
+                                         _busy, NULL, "busy", &attr);
+    if (pid < 0) {
+        printf("thread_create_ext() failed: %d\n", (int)pid);
+        puts("[FAILED]");
+        return 1;
+    }
+
+    /* main only gets here again if the busy thread gets throttled */
+    puts("main is running");
+    ztimer_sleep(ZTIMER_USEC, PERIODS * PERIOD);
+
+    unsigned throttled = sched_budget_throttled(pid);
+    bool ok = (throttled >= PERIODS - 1) && (throttled <= PERIODS + 1);
+    printf("throttled: %s\n", ok ? "ok" : "wrong");
+    if (!ok || !loops) {
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ * @file
+ * @brief       Test sys/sched_edf
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "sched_edf.h"
+#include "thread.h"
+#include "timex.h"
+
+static kernel_pid_t main_pid;
+
+static char stack[2][THREAD_STACKSIZE_DEFAULT];
+
+static void *_job(void *arg)
+{
+    const char *name = arg;
+
+    printf("%s running\n", name);
+    if (name[0] == 'A') {
+        thread_wakeup(main_pid);
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    puts("starting threads");
+    main_pid = thread_getpid();
+
+    /* stay above the EDF band until both threads are woken up, with the
+     * default SCHED_EDF_PRIO main already is */
+    if (thread_get_active()->priority >= SCHED_EDF_PRIO) {
+        sched_change_priority(thread_get_active(), SCHED_EDF_PRIO - 1);
+    }
+
+    kernel_pid_t a = thread_create(stack[0], sizeof(stack[0]),
+                                   SCHED_EDF_PRIO,
+                                   THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                                   _job, "A", "A");
+    kernel_pid_t b = thread_create(stack[1], sizeof(stack[1]),
+                                   SCHED_EDF_PRIO,
+                                   THREAD_CREATE_SLEEPING | THREAD_CREATE_STACKTEST,
+                                   _job, "B", "B");
+
+    /* A: 40% with a deadline in 200ms, B: 40% with a deadline in 100ms */
+    if (sched_edf_admit(thread_get(a), 80 * US_PER_MS, 200 * US_PER_MS) ||
+        sched_edf_admit(thread_get(b), 40 * US_PER_MS, 100 * US_PER_MS)) {
+        puts("[FAILED] admission");
+        return 1;
+    }
+    if (sched_edf_admit(thread_get_active(), 30 * US_PER_MS, 100 * US_PER_MS)
+        != -ENOSPC) {
+        puts("[FAILED] admission control");
+        return 1;
+    }
+    puts("admission control ok");
+
+    thread_wakeup(a);
+    thread_wakeup(b);
+    thread_sleep();
+
+    printf("misses: %u %u\n", sched_edf_misses(a), sched_edf_misses(b));
+    puts("[SUCCESS]");
+    return 0;
+}
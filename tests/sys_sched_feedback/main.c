@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test a CPU bound thread sharing the CPU with threads woken up
+ *              on lower feedback levels
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "sched.h"
+#include "sched_feedback.h"
+#include "thread.h"
+#include "ztimer.h"
+
+/* far longer than the quanta main has to use up before being demoted */
+#define TIMEOUT_MS      (1000U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT_LOCKED;
+static volatile unsigned _woken;
+
+static void *_helper(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    msg_receive(&msg);
+    _woken++;
+    mutex_lock(&_mutex);
+    _woken++;
+    thread_sleep();
+    _woken++;
+    return NULL;
+}
+
+/* busy waits, true if cond became true in time */
+static bool _spin(bool (*cond)(kernel_pid_t), kernel_pid_t pid)
+{
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    while (!cond(pid)) {
+        if (ztimer_now(ZTIMER_MSEC) - start > TIMEOUT_MS) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static unsigned _expected;
+
+static bool _is_woken(kernel_pid_t pid)
+{
+    (void)pid;
+    return _woken == _expected;
+}
+
+static bool _is_mutex_blocked(kernel_pid_t pid)
+{
+    return thread_getstatus(pid) == STATUS_MUTEX_BLOCKED;
+}
+
+static bool _is_sleeping(kernel_pid_t pid)
+{
+    return thread_getstatus(pid) == STATUS_SLEEPING;
+}
+
+static bool _wake(const char *how, kernel_pid_t pid)
+{
+    /* main is CPU bound on the first level, the helper waits on the last */
+    sched_change_priority(thread_get_active(), SCHED_FEEDBACK_LEVEL_FIRST);
+    _expected++;
+    printf("waking up helper by %s\n", how);
+
+    switch (_expected) {
+    case 1: {
+        msg_t msg = { 0 };
+        msg_send(&msg, pid);
+        break;
+    }
+    case 2:
+        mutex_unlock(&_mutex);
+        break;
+    default:
+        thread_wakeup(pid);
+        break;
+    }
+
+    return _spin(_is_woken, pid);
+}
+
+int main(void)
+{
+    static const thread_attr_t attr = {
+        .policy = THREAD_SCHED_FEEDBACK, .level = SCHED_FEEDBACK_LEVEL_LAST,
+    };
+
+    puts("starting helper");
+    kernel_pid_t pid = thread_create_ext(_stack, sizeof(_stack), 0,
+                                         THREAD_CREATE_STACKTEST,
+                                         _helper, NULL, "helper", &attr);
+    if (pid < 0) {
+        puts("[FAILED] thread_create_ext()");
+        return 1;
+    }
+
+    if (!_wake("message", pid) ||
+        !_spin(_is_mutex_blocked, pid) ||
+        !_wake("mutex", pid) ||
+        !_spin(_is_sleeping, pid) ||
+        !_wake("thread_wakeup", pid)) {
+        puts("[FAILED] helper starved");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
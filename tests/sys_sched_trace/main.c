@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ * @file
+ * @brief       Test sys/sched_trace
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "sched_trace.h"
+#include "thread.h"
+
+#define MESSAGES    (8U)
+
+static char stack[THREAD_STACKSIZE_DEFAULT];
+
+static kernel_pid_t receiver_pid;
+static bool header_seen;
+static unsigned names;
+static unsigned name_len;
+static unsigned preempted;
+static unsigned blocked;
+static unsigned failed;
+
+static void *_receiver(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while (1) {
+        msg_receive(&m);
+    }
+    return NULL;
+}
+
+static ssize_t _check(void *arg, const void *data, size_t len)
+{
+    (void)arg;
+
+    if (!header_seen) {
+        const sched_trace_hdr_t *hdr = data;
+        if ((len != sizeof(*hdr)) || (hdr->magic != SCHED_TRACE_MAGIC) ||
+            (hdr->rec_size != sizeof(sched_trace_rec_t))) {
+            failed++;
+        }
+        header_seen = true;
+        names = hdr->names;
+    }
+    else if (name_len) {
+        /* name of the last thread name entry */
+        name_len = 0;
+        names--;
+    }
+    else if (names) {
+        /* thread name entry: int16_t pid, uint8_t name length */
+        name_len = ((const uint8_t *)data)[2];
+        if (!name_len) {
+            names--;
+        }
+    }
+    else if (len == sizeof(sched_trace_rec_t)) {
+        sched_trace_rec_t rec;
+        memcpy(&rec, data, sizeof(rec));
+        if ((rec.prev == thread_getpid()) && (rec.next == receiver_pid)) {
+            preempted += (rec.reason == STATUS_RUNNING);
+        }
+        else if ((rec.prev == receiver_pid) && (rec.next == thread_getpid())) {
+            blocked += (rec.reason == STATUS_RECEIVE_BLOCKED);
+        }
+    }
+    else {
+        failed++;
+    }
+    return len;
+}
+
+int main(void)
+{
+    puts("starting receiver");
+    receiver_pid = thread_create(stack, sizeof(stack),
+                                 THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                                 _receiver, NULL, "receiver");
+
+    sched_trace_reset();
+    for (unsigned i = 0; i < MESSAGES; i++) {
+        msg_t m = { .content.value = i };
+        msg_send(&m, receiver_pid);
+    }
+    sched_trace_enable(false);
+
+    int records = sched_trace_dump(_check, NULL);
+    printf("records: %d, preempted: %u, blocked: %u\n",
+           records, preempted, blocked);
+
+    if (failed || (records < (int)(2 * MESSAGES)) ||
+        (preempted != MESSAGES) || (blocked != MESSAGES)) {
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for priority inheritance along a chain of
+ *              mutex owners and with several mutexes held at once
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "fmt.h"
+#include "irq.h"
+#include "mutex.h"
+#include "thread.h"
+
+static mutex_t mtx_a = MUTEX_INIT;
+static mutex_t mtx_b = MUTEX_INIT;
+static mutex_t mtx_start_low = MUTEX_INIT_LOCKED;
+static mutex_t mtx_start_chain = MUTEX_INIT_LOCKED;
+static mutex_t mtx_start_busy = MUTEX_INIT_LOCKED;
+static mutex_t mtx_start_high = MUTEX_INIT_LOCKED;
+static mutex_t mtx_c = MUTEX_INIT;
+static mutex_t mtx_d = MUTEX_INIT;
+static mutex_t mtx_start_nested_low = MUTEX_INIT_LOCKED;
+static mutex_t mtx_start_nested_busy = MUTEX_INIT_LOCKED;
+static mutex_t mtx_start_nested_high = MUTEX_INIT_LOCKED;
+
+static char stack_low[THREAD_STACKSIZE_SMALL];
+static char stack_chain[THREAD_STACKSIZE_SMALL];
+static char stack_busy[THREAD_STACKSIZE_SMALL];
+static char stack_high[THREAD_STACKSIZE_SMALL];
+
+static char run_order[8] = "";
+static size_t run_order_pos = 0;
+
+static void record_thread_done(const char *priority)
+{
+    print_str(priority);
+    print_str(" priority thread is done\n");
+
+    unsigned irq_state = irq_disable();
+    run_order[run_order_pos++] = priority[0];
+    irq_restore(irq_state);
+}
+
+static void *low_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_low);
+    mutex_lock(&mtx_a);
+
+    /* chain blocks on A, high blocks on B held by chain */
+    mutex_unlock(&mtx_start_chain);
+    mutex_unlock(&mtx_start_high);
+    /* must not preempt us, we run at the priority of high now */
+    mutex_unlock(&mtx_start_busy);
+
+    record_thread_done("low");
+    mutex_unlock(&mtx_a);
+
+    return NULL;
+}
+
+static void *chain_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_chain);
+    mutex_lock(&mtx_b);
+    mutex_lock(&mtx_a);
+
+    record_thread_done("chain");
+    mutex_unlock(&mtx_a);
+    mutex_unlock(&mtx_b);
+
+    return NULL;
+}
+
+static void *busy_handler(void *arg)
+{
+    mutex_lock(arg);
+
+    record_thread_done("busy");
+    return NULL;
+}
+
+static void *high_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_high);
+    mutex_lock(&mtx_b);
+
+    record_thread_done("high");
+    mutex_unlock(&mtx_b);
+
+    return NULL;
+}
+
+static void *nested_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_nested_low);
+    mutex_lock(&mtx_c);
+    mutex_lock(&mtx_d);
+
+    /* high blocks on C */
+    mutex_unlock(&mtx_start_nested_high);
+    /* nobody waits for D, but high still waits for C */
+    mutex_unlock(&mtx_d);
+    /* must not preempt us, we still run at the priority of high */
+    mutex_unlock(&mtx_start_nested_busy);
+
+    record_thread_done("low");
+    mutex_unlock(&mtx_c);
+
+    return NULL;
+}
+
+static void *nested_high_handler(void *arg)
+{
+    (void)arg;
+    mutex_lock(&mtx_start_nested_high);
+    mutex_lock(&mtx_c);
+
+    record_thread_done("high");
+    mutex_unlock(&mtx_c);
+
+    return NULL;
+}
+
+static bool check_run_order(const char *expected, const char *inversion)
+{
+    if (strcmp(expected, run_order) == 0) {
+        return true;
+    }
+    else if (run_order[0] == 'b') {
+        print_str(inversion);
+    }
+    else {
+        print_str("BUG: \"");
+        print_str(run_order);
+        print_str("\"\n");
+    }
+
+    return false;
+}
+
+int main(void)
+{
+    thread_create(stack_low, sizeof(stack_low),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  low_handler, NULL, "low");
+
+    thread_create(stack_chain, sizeof(stack_chain),
+                  THREAD_PRIORITY_MAIN - 2, THREAD_CREATE_STACKTEST,
+                  chain_handler, NULL, "chain");
+
+    thread_create(stack_busy, sizeof(stack_busy),
+                  THREAD_PRIORITY_MAIN - 3, THREAD_CREATE_STACKTEST,
+                  busy_handler, &mtx_start_busy, "busy");
+
+    thread_create(stack_high, sizeof(stack_high),
+                  THREAD_PRIORITY_MAIN - 4, THREAD_CREATE_STACKTEST,
+                  high_handler, NULL, "high");
+
+    /* all other threads have a higher priority, so this only returns once
+     * all of them are done */
+    mutex_unlock(&mtx_start_low);
+
+    if (!check_run_order("lchb",
+                         "==> Priority inversion along the chain occurred\n")) {
+        print_str("TEST FAILED\n");
+        return 0;
+    }
+
+    /* the threads above are done, their stacks can be reused */
+    memset(run_order, 0, sizeof(run_order));
+    run_order_pos = 0;
+
+    thread_create(stack_low, sizeof(stack_low),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  nested_handler, NULL, "low");
+
+    thread_create(stack_busy, sizeof(stack_busy),
+                  THREAD_PRIORITY_MAIN - 3, THREAD_CREATE_STACKTEST,
+                  busy_handler, &mtx_start_nested_busy, "busy");
+
+    thread_create(stack_high, sizeof(stack_high),
+                  THREAD_PRIORITY_MAIN - 4, THREAD_CREATE_STACKTEST,
+                  nested_high_handler, NULL, "high");
+
+    mutex_unlock(&mtx_start_nested_low);
+
+    if (!check_run_order("lhb",
+                         "==> Boost dropped while still holding a mutex\n")) {
+        print_str("TEST FAILED\n");
+        return 0;
+    }
+
+    print_str("TEST PASSED\n");
+    return 0;
+}
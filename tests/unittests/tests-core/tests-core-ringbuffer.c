@@ -152,12 +152,61 @@ static void tests_core_ringbuffer_remove_underflow(void)
     TEST_ASSERT_EQUAL_INT(1, ringbuffer_empty(&buf));
 }
 
+static void tests_core_ringbuffer_span(void)
+{
+    char mem[5];
+    char *wdata;
+    const char *rdata;
+    ringbuffer_t buf;
+    ringbuffer_init(&buf, mem, sizeof(mem));
+
+    /* an empty buffer hands out all of its memory */
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_get_span(&buf, &rdata));
+    TEST_ASSERT_EQUAL_INT(5, ringbuffer_add_span(&buf, &wdata));
+    TEST_ASSERT(wdata == mem);
+    wdata[0] = 0;
+    wdata[1] = 1;
+    wdata[2] = 2;
+    wdata[3] = 3;
+    ringbuffer_add_commit(&buf, 4);
+
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_get_span(&buf, &rdata));
+    TEST_ASSERT(rdata == mem);
+    ringbuffer_get_commit(&buf, 3);
+
+    /* the free space is split by the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_add_span(&buf, &wdata));
+    TEST_ASSERT(wdata == &mem[4]);
+    wdata[0] = 4;
+    ringbuffer_add_commit(&buf, 1);
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_add_span(&buf, &wdata));
+    TEST_ASSERT(wdata == mem);
+    wdata[0] = 5;
+    ringbuffer_add_commit(&buf, 1);
+
+    /* so is the data */
+    TEST_ASSERT_EQUAL_INT(2, ringbuffer_get_span(&buf, &rdata));
+    TEST_ASSERT_EQUAL_INT(3, rdata[0]);
+    TEST_ASSERT_EQUAL_INT(4, rdata[1]);
+    ringbuffer_get_commit(&buf, 2);
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_get_span(&buf, &rdata));
+    TEST_ASSERT_EQUAL_INT(5, rdata[0]);
+
+    /* ringbuffer_add() fills both parts */
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_add(&buf, "\x06\x07\x08\x09\x0a", 5));
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_full(&buf));
+    for (int i = 5; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(i, ringbuffer_get_one(&buf));
+    }
+}
+
 Test *tests_core_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(tests_core_ringbuffer),
         new_TestFixture(tests_core_ringbuffer_remove),
         new_TestFixture(tests_core_ringbuffer_remove_underflow),
+        new_TestFixture(tests_core_ringbuffer_span),
     };
 
     EMB_UNIT_TESTCALLER(ringbuffer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "msg.h"
+#include "thread.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+
+#include "unittests-constants.h"
+#include "tests-gnrc_netapi_batch.h"
+
+/* the test thread subscribes itself, so its queue has to hold a message for
+ * every packet of a chain dispatched to two subscribers */
+#define MSG_QUEUE_SIZE  (2 * CONFIG_GNRC_NETAPI_BATCH_SIZE)
+#define CTX1            (TEST_UINT16)
+#define CTX2            (TEST_UINT16 + 1)
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _entries[2];
+static gnrc_netapi_batch_t _batch;
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    gnrc_netreg_init();
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    memset(&_batch, 0, sizeof(_batch));
+}
+
+static void tear_down(void)
+{
+    msg_t msg;
+
+    while (msg_try_receive(&msg) == 1) { }
+}
+
+static void _register(unsigned i, gnrc_nettype_t type, uint32_t demux_ctx,
+                      bool batch)
+{
+    if (batch) {
+        gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_BATCH(demux_ctx,
+                                                                 thread_getpid());
+        _entries[i] = entry;
+    }
+    else {
+        gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(demux_ctx,
+                                                               thread_getpid());
+        _entries[i] = entry;
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(type, &_entries[i]));
+}
+
+static void _pkts(gnrc_pktsnip_t **pkts, unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        pkts[i] = gnrc_pktbuf_add(NULL, TEST_STRING8, sizeof(TEST_STRING8),
+                                  GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkts[i]);
+    }
+}
+
+/* allocates numof packets linked by next_pkt */
+static void _chain(gnrc_pktsnip_t **pkts, unsigned numof)
+{
+    _pkts(pkts, numof);
+    for (unsigned i = 0; i < numof; i++) {
+        pkts[i]->next_pkt = (i < (numof - 1)) ? pkts[i + 1] : NULL;
+    }
+}
+
+/* receives a message without blocking */
+static void _recv(uint16_t type, gnrc_pktsnip_t **pkt)
+{
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(type, msg.type);
+    *pkt = msg.content.ptr;
+}
+
+/* receives a chain of numof packets and releases it */
+static void _recv_chain(gnrc_pktsnip_t **pkts, unsigned numof)
+{
+    gnrc_pktsnip_t *pkt;
+
+    _recv(GNRC_NETAPI_MSG_TYPE_RCV_BATCH, &pkt);
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktsnip_t *next;
+
+        TEST_ASSERT(pkts[i] == pkt);
+        next = pkt->next_pkt;
+        gnrc_pktbuf_release(pkt);
+        pkt = next;
+    }
+    TEST_ASSERT_NULL(pkt);
+}
+
+static void test_batch_add__ctx_change(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    _register(0, GNRC_NETTYPE_TEST, CTX1, true);
+    _register(1, GNRC_NETTYPE_TEST, CTX2, true);
+    _pkts(pkts, 3);
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1, pkts[0]);
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1, pkts[1]);
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+    /* the chain for CTX1 is passed on before pkts[2] is added */
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX2, pkts[2]);
+    TEST_ASSERT_EQUAL_INT(1, msg_avail());
+    _recv_chain(&pkts[0], 2);
+    TEST_ASSERT(pkts[2] == _batch.head);
+    TEST_ASSERT_EQUAL_INT(1, _batch.numof);
+    TEST_ASSERT_EQUAL_INT(CTX2, _batch.demux_ctx);
+    gnrc_netapi_batch_flush(&_batch);
+    TEST_ASSERT_NULL(_batch.head);
+    TEST_ASSERT_EQUAL_INT(0, _batch.numof);
+    _recv_chain(&pkts[2], 1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_batch_add__type_change(void)
+{
+    gnrc_pktsnip_t *pkts[2];
+
+    _register(0, GNRC_NETTYPE_TEST, CTX1, true);
+    _register(1, GNRC_NETTYPE_UNDEF, CTX1, true);
+    _pkts(pkts, 2);
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1, pkts[0]);
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_UNDEF, CTX1, pkts[1]);
+    TEST_ASSERT_EQUAL_INT(1, msg_avail());
+    _recv_chain(&pkts[0], 1);
+    TEST_ASSERT(pkts[1] == _batch.head);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_UNDEF, _batch.type);
+    gnrc_netapi_batch_flush(&_batch);
+    _recv_chain(&pkts[1], 1);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_batch_add__full(void)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE];
+
+    _register(0, GNRC_NETTYPE_TEST, CTX1, true);
+    _pkts(pkts, CONFIG_GNRC_NETAPI_BATCH_SIZE);
+    for (unsigned i = 0; i < (CONFIG_GNRC_NETAPI_BATCH_SIZE - 1); i++) {
+        gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1, pkts[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_NETAPI_BATCH_SIZE - 1, _batch.numof);
+    /* the batch is passed on as soon as it is full */
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1,
+                          pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(1, msg_avail());
+    TEST_ASSERT_NULL(_batch.head);
+    TEST_ASSERT_NULL(_batch.tail);
+    TEST_ASSERT_EQUAL_INT(0, _batch.numof);
+    _recv_chain(pkts, CONFIG_GNRC_NETAPI_BATCH_SIZE);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_batch_flush__empty(void)
+{
+    _register(0, GNRC_NETTYPE_TEST, CTX1, true);
+    gnrc_netapi_batch_flush(&_batch);
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+}
+
+static void test_batch_flush__no_subscriber(void)
+{
+    gnrc_pktsnip_t *pkts[2];
+
+    _pkts(pkts, 2);
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1, pkts[0]);
+    gnrc_netapi_batch_add(&_batch, GNRC_NETTYPE_TEST, CTX1, pkts[1]);
+    gnrc_netapi_batch_flush(&_batch);
+    TEST_ASSERT_NULL(_batch.head);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_dispatch_receive_batch__no_subscriber(void)
+{
+    gnrc_pktsnip_t *pkts[2];
+
+    _chain(pkts, 2);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netapi_dispatch_receive_batch(
+                                GNRC_NETTYPE_TEST, CTX1, pkts[0]));
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+    /* the packets still belong to the caller */
+    TEST_ASSERT(pkts[1] == pkts[0]->next_pkt);
+    TEST_ASSERT_EQUAL_INT(1, pkts[0]->users);
+    TEST_ASSERT_EQUAL_INT(1, pkts[1]->users);
+    gnrc_pktbuf_release(pkts[0]);
+    gnrc_pktbuf_release(pkts[1]);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_dispatch_receive_batch__non_batch_subscriber(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    _register(0, GNRC_NETTYPE_TEST, CTX1, false);
+    _chain(pkts, 3);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_receive_batch(
+                                GNRC_NETTYPE_TEST, CTX1, pkts[0]));
+    /* one message per packet */
+    TEST_ASSERT_EQUAL_INT(3, msg_avail());
+    for (unsigned i = 0; i < 3; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _recv(GNRC_NETAPI_MSG_TYPE_RCV, &pkt);
+        TEST_ASSERT(pkts[i] == pkt);
+        TEST_ASSERT_EQUAL_INT(1, pkt->users);
+        gnrc_pktbuf_release(pkt);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_dispatch_receive_batch__several_subscribers(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+
+    /* even batch subscribers get single packets if there is more than one */
+    _register(0, GNRC_NETTYPE_TEST, CTX1, true);
+    _register(1, GNRC_NETTYPE_TEST, CTX1, true);
+    _chain(pkts, 3);
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netapi_dispatch_receive_batch(
+                                GNRC_NETTYPE_TEST, CTX1, pkts[0]));
+    TEST_ASSERT_EQUAL_INT(6, msg_avail());
+    for (unsigned i = 0; i < 3; i++) {
+        for (unsigned j = 0; j < 2; j++) {
+            gnrc_pktsnip_t *pkt;
+
+            _recv(GNRC_NETAPI_MSG_TYPE_RCV, &pkt);
+            TEST_ASSERT(pkts[i] == pkt);
+            TEST_ASSERT_EQUAL_INT(2 - j, pkt->users);
+            gnrc_pktbuf_release(pkt);
+        }
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_dispatch_receive_batch__send_failed(void)
+{
+    gnrc_pktsnip_t *pkts[3];
+    msg_t msg = { .type = TEST_UINT16 };
+
+    _register(0, GNRC_NETTYPE_TEST, CTX1, true);
+    /* fill the queue of the subscriber */
+    while (msg_send_to_self(&msg) == 1) { }
+    _chain(pkts, 3);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_receive_batch(
+                                GNRC_NETTYPE_TEST, CTX1, pkts[0]));
+    /* the whole chain is released */
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    /* and nothing was queued */
+    for (unsigned i = 0; i < MSG_QUEUE_SIZE; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _recv(TEST_UINT16, &pkt);
+    }
+    TEST_ASSERT_EQUAL_INT(0, msg_avail());
+}
+
+static Test *tests_gnrc_netapi_batch_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_batch_add__ctx_change),
+        new_TestFixture(test_batch_add__type_change),
+        new_TestFixture(test_batch_add__full),
+        new_TestFixture(test_batch_flush__empty),
+        new_TestFixture(test_batch_flush__no_subscriber),
+        new_TestFixture(test_dispatch_receive_batch__no_subscriber),
+        new_TestFixture(test_dispatch_receive_batch__non_batch_subscriber),
+        new_TestFixture(test_dispatch_receive_batch__several_subscribers),
+        new_TestFixture(test_dispatch_receive_batch__send_failed),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_netapi_batch_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_netapi_batch_tests;
+}
+
+void tests_gnrc_netapi_batch(void)
+{
+    TESTS_RUN(tests_gnrc_netapi_batch_tests());
+}
+/** @} */
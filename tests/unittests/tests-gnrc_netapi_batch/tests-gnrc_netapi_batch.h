@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup unittests
+ * @{
+ *
+ * @file
+ * @brief   unittests for the `gnrc_netapi_batch` module
+ */
+#ifndef TESTS_GNRC_NETAPI_BATCH_H
+#define TESTS_GNRC_NETAPI_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_gnrc_netapi_batch(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_GNRC_NETAPI_BATCH_H */
+/** @} */
@@ -213,6 +213,51 @@ static void test_add(void)
     }
 }
 
+static void test_span(void)
+{
+    const uint8_t *rdata;
+    uint8_t *wdata;
+
+    /* move the start of the data close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_add(&_tsrb, _io_buffer,
+                                   BUFFER_SIZE - TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM));
+
+    /* the free space is split by the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_add_span(&_tsrb, &wdata));
+    TEST_ASSERT(wdata == &_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM]);
+    for (unsigned i = 0; i < TEST_DROP_NUM; i++) {
+        wdata[i] = TEST_INPUT + i;
+    }
+    TEST_ASSERT_EQUAL_INT(0, tsrb_avail(&_tsrb));
+    tsrb_add_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_avail(&_tsrb));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_add_span(&_tsrb, &wdata));
+    TEST_ASSERT(wdata == _tsrb_buffer);
+    wdata[0] = TEST_INPUT + TEST_DROP_NUM;
+    tsrb_add_commit(&_tsrb, 1);
+
+    /* so is the data */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_get_span(&_tsrb, &rdata));
+    for (unsigned i = 0; i < TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + i, rdata[i]);
+    }
+    tsrb_get_commit(&_tsrb, TEST_DROP_NUM - 1);
+    TEST_ASSERT_EQUAL_INT(2, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_get_span(&_tsrb, &rdata));
+    tsrb_get_commit(&_tsrb, 1);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_get_span(&_tsrb, &rdata));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + TEST_DROP_NUM, rdata[0]);
+    tsrb_get_commit(&_tsrb, 1);
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_get_span(&_tsrb, &rdata));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +273,7 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_span),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
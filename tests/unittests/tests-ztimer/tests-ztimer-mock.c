@@ -288,6 +288,56 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+typedef struct {
+    ztimer_clock_t *clock;
+    ztimer_t *timer;
+    uint32_t count;
+} rearm_arg_t;
+
+/**
+ * @brief   Callback re-setting another timer
+ */
+static void cb_rearm(void *arg)
+{
+    rearm_arg_t *rearm = arg;
+
+    rearm->count++;
+    ztimer_remove(rearm->clock, rearm->timer);
+    ztimer_set(rearm->clock, rearm->timer, 100);
+}
+
+/**
+ * @brief   Testing callbacks of expired timers running in one batch
+ */
+static void test_ztimer_mock_batch(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t next = { .callback = cb_incr, .arg = &count };
+    rearm_arg_t rearm = { .clock = z, .timer = &next };
+    ztimer_t alarms[3];
+
+    ztimer_mock_init(&zmock, 32);
+
+    for (unsigned i = 0; i < 3; i++) {
+        alarms[i] = (ztimer_t){ .callback = cb_rearm, .arg = &rearm };
+        ztimer_set(z, &alarms[i], 10);
+    }
+
+    /* the clock is armed once after all callbacks ran */
+    unsigned sets = zmock.calls.set;
+    ztimer_mock_advance(&zmock, 10);
+    TEST_ASSERT_EQUAL_INT(3, rearm.count);
+    TEST_ASSERT_EQUAL_INT(sets + 1, zmock.calls.set);
+    TEST_ASSERT(ztimer_is_set(z, &next));
+
+    ztimer_mock_advance(&zmock, 99);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -298,6 +348,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_batch),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
@@ -67,6 +67,9 @@ int main(void)
     ZTIMER_USEC->adjust_sleep = 0;
     printf("ZTIMER_USEC auto_adjust params cleared\n");
 
+    static ztimer_overhead_latency_t latency;
+    ztimer_overhead_latency_attach(ZTIMER_USEC, &latency);
+
     printf("zitmer_overhead_set...\n");
     ZTIMER_USEC->adjust_set = _ztimer_usec_overhead(SAMPLES, BASE, ztimer_overhead_set);
     printf("zitmer_overhead_sleep...\n");
@@ -75,5 +78,9 @@ int main(void)
     printf("    CONFIG_ZTIMER_USEC_ADJUST_SET    %" PRIi16 "\n", ZTIMER_USEC->adjust_set);
     printf("    CONFIG_ZTIMER_USEC_ADJUST_SLEEP  %" PRIi16 "\n", ZTIMER_USEC->adjust_sleep);
 
+    ztimer_overhead_latency_attach(ZTIMER_USEC, NULL);
+    printf("ZTIMER_USEC ISR latency:\n");
+    ztimer_overhead_latency_print(&latency);
+
     return 0;
 }
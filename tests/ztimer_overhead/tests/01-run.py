@@ -12,6 +12,8 @@ from testrunner import run
 
 ADJUST_SET_MARGIN = 1
 ADJUST_SLEEP_MARGIN = 1
+SAMPLES = 1024
+LATENCY_BUCKETS = 12
 
 
 def testfunc(child):
@@ -27,6 +29,14 @@ def testfunc(child):
     adjust_sleep = int(child.match.group(1))
     assert auto_adjust_set >= adjust_set - ADJUST_SET_MARGIN
     assert auto_adjust_sleep >= adjust_sleep - ADJUST_SLEEP_MARGIN
+    child.expect_exact("ZTIMER_USEC ISR latency:\r\n")
+    # every set() and sleep() sample fires once, ISRs arriving before the
+    # time the clock was armed for are not counted
+    isrs = 0
+    for _ in range(LATENCY_BUCKETS):
+        child.expect(r"\s*\d+(?: - \s*\d+|\+)\s*: (\d+)\r\n")
+        isrs += int(child.match.group(1))
+    assert 0 < isrs <= 2 * SAMPLES
 
 
 if __name__ == "__main__":
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the ztimer unittests with ztimer_slack
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "tests-ztimer.h"
+
+Test *tests_ztimer_slack_tests(void);
+
+int main(void)
+{
+    TESTS_START();
+    tests_ztimer();
+    TESTS_RUN(tests_ztimer_slack_tests());
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer timer coalescing
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+/**
+ * @brief   Simple callback for counting alarms
+ */
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+/**
+ * @brief   Testing timers with slack being handled in one ISR
+ */
+static void test_ztimer_slack_coalesce(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t a = { .callback = cb_incr, .arg = &count };
+    ztimer_t b = { .callback = cb_incr, .arg = &count };
+    ztimer_t c = { .callback = cb_incr, .arg = &count };
+
+    ztimer_mock_init(&zmock, 32);
+
+    /* a may fire up to 50 ticks late, so it can wait for b */
+    ztimer_set_slack(z, &a, 100, 50);
+    ztimer_set(z, &b, 120);
+    /* c is beyond the slack of a */
+    ztimer_set(z, &c, 300);
+
+    ztimer_mock_advance(&zmock, 119);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    TEST_ASSERT(ztimer_is_set(z, &a));
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT_EQUAL_INT(1, z->coalesced);
+
+    ztimer_mock_advance(&zmock, 179);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT_EQUAL_INT(1, z->coalesced);
+}
+
+/**
+ * @brief   Testing timers firing at the end of their slack
+ */
+static void test_ztimer_slack_deadline(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t a = { .callback = cb_incr, .arg = &count };
+    ztimer_t b = { .callback = cb_incr, .arg = &count };
+
+    ztimer_mock_init(&zmock, 32);
+
+    /* b starts after a's slack, so a fires at the end of its slack */
+    ztimer_set_slack(z, &a, 100, 20);
+    ztimer_set_slack(z, &b, 130, 100);
+
+    ztimer_mock_advance(&zmock, 119);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(ztimer_is_set(z, &b));
+
+    /* re-setting a timer without slack clears its slack */
+    ztimer_set(z, &a, 5);
+    ztimer_mock_advance(&zmock, 5);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT_EQUAL_INT(0, z->coalesced);
+
+    /* alone, b fires at the end of its slack */
+    ztimer_mock_advance(&zmock, 104);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(3, count);
+}
+
+/**
+ * @brief   Testing that the clock is only armed when the deadline moves
+ */
+static void test_ztimer_slack_arm(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    ztimer_t a = { .callback = cb_incr, .arg = &count };
+    ztimer_t b = { .callback = cb_incr, .arg = &count };
+    ztimer_t c = { .callback = cb_incr, .arg = &count };
+
+    ztimer_mock_init(&zmock, 32);
+
+    ztimer_set_slack(z, &a, 100, 50);
+    unsigned sets = zmock.calls.set;
+
+    /* within the slack of a, the deadline stays at 150 */
+    ztimer_set_slack(z, &b, 120, 100);
+    TEST_ASSERT_EQUAL_INT(sets, zmock.calls.set);
+    /* a new first timer whose slack ends after 150 */
+    ztimer_set_slack(z, &c, 90, 70);
+    TEST_ASSERT_EQUAL_INT(sets, zmock.calls.set);
+
+    /* moving the deadline arms the clock */
+    ztimer_set(z, &c, 130);
+    TEST_ASSERT_EQUAL_INT(sets + 1, zmock.calls.set);
+    TEST_ASSERT_EQUAL_INT(130, zmock.target);
+
+    /* moving the deadline back out as well */
+    ztimer_remove(z, &c);
+    TEST_ASSERT_EQUAL_INT(150, zmock.target);
+
+    ztimer_mock_advance(&zmock, 149);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, count);
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_coalesce),
+        new_TestFixture(test_ztimer_slack_deadline),
+        new_TestFixture(test_ztimer_slack_arm),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_slack_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_slack_tests;
+}
+
+/** @} */
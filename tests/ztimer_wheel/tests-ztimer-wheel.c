@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer timer wheels
+ */
+
+#include <string.h>
+
+#include "container.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+/**
+ * @brief   Simple callback for counting alarms
+ */
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+/**
+ * @brief   Testing timers firing exactly at their targets across all levels
+ */
+static void test_ztimer_wheel_targets(void)
+{
+    /* sorted, spanning several levels and slot boundaries */
+    static const uint32_t targets[] = {
+        1, 15, 16, 17, 50, 255, 256, 4097, 70000, 1000000, 0x10000000ul,
+    };
+    ztimer_t alarms[ARRAY_SIZE(targets)] = { 0 };
+    ztimer_wheel_t wheel;
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+    uint32_t now = 0;
+
+    ztimer_mock_init(&zmock, 32);
+
+    /* timers set before the wheel is attached are moved into it */
+    alarms[4].callback = cb_incr;
+    alarms[4].arg = &count;
+    ztimer_set(z, &alarms[4], targets[4]);
+    ztimer_wheel_attach(z, &wheel);
+    TEST_ASSERT(ztimer_is_set(z, &alarms[4]));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(targets); i++) {
+        if (i == 4) {
+            continue;
+        }
+        alarms[i].callback = cb_incr;
+        alarms[i].arg = &count;
+        ztimer_set(z, &alarms[i], targets[i]);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(targets); i++) {
+        ztimer_mock_advance(&zmock, targets[i] - 1 - now);
+        TEST_ASSERT_EQUAL_INT(i, count);
+        TEST_ASSERT(ztimer_is_set(z, &alarms[i]));
+        ztimer_mock_advance(&zmock, 1);
+        now = targets[i];
+        TEST_ASSERT_EQUAL_INT(i + 1, count);
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+    }
+    TEST_ASSERT(ztimer_wheel_is_empty(&wheel));
+}
+
+/**
+ * @brief   Testing ztimer_remove() on timers stored in a wheel
+ */
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_t alarms[3] = { 0 };
+    ztimer_wheel_t wheel;
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_wheel_attach(z, &wheel);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        alarms[i].callback = cb_incr;
+        alarms[i].arg = &count;
+        ztimer_set(z, &alarms[i], 1000 * (i + 1));
+    }
+
+    ztimer_remove(z, &alarms[1]);
+    TEST_ASSERT(ztimer_is_set(z, &alarms[0]));
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[1]));
+    TEST_ASSERT(ztimer_is_set(z, &alarms[2]));
+
+    /* removing an unset timer is a no-op */
+    ztimer_remove(z, &alarms[1]);
+
+    /* re-setting a timer moves it */
+    ztimer_set(z, &alarms[0], 5000);
+    ztimer_mock_advance(&zmock, 3000);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock, 2000);
+    TEST_ASSERT_EQUAL_INT(2, count);
+
+    ztimer_remove(z, &alarms[0]);
+    ztimer_remove(z, &alarms[2]);
+    TEST_ASSERT(ztimer_wheel_is_empty(&wheel));
+}
+
+/**
+ * @brief   Testing timers whose target wraps around the 32 bit range
+ */
+static void test_ztimer_wheel_wrap(void)
+{
+    ztimer_t alarm = { .callback = cb_incr };
+    ztimer_t far = { .callback = cb_incr };
+    ztimer_wheel_t wheel;
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+
+    alarm.arg = &count;
+    far.arg = &count;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_mock_jump(&zmock, 0xffffff00ul);
+    ztimer_wheel_attach(z, &wheel);
+
+    ztimer_set(z, &alarm, 0x200);
+    /* a full revolution of the top level away */
+    ztimer_set(z, &far, 0xfffffff0ul);
+
+    ztimer_mock_advance(&zmock, 0x1ff);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(ztimer_is_set(z, &far));
+
+    ztimer_mock_advance(&zmock, 0xfffffff0ul - 0x201);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT(ztimer_wheel_is_empty(&wheel));
+}
+
+/**
+ * @brief   Testing timers that were not initialized before use
+ */
+static void test_ztimer_wheel_uninitialized(void)
+{
+    ztimer_t alarm = { .callback = cb_incr };
+    ztimer_t garbage;
+    ztimer_wheel_t wheel;
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    uint32_t count = 0;
+
+    alarm.arg = &count;
+
+    ztimer_mock_init(&zmock, 32);
+    ztimer_wheel_attach(z, &wheel);
+    ztimer_set(z, &alarm, 100);
+
+    /* stack garbage that looks like a timer linked behind alarm */
+    memset(&garbage, 0xa5, sizeof(garbage));
+    garbage.base.next = &alarm.base;
+    garbage.base.offset = alarm.base.offset;
+    garbage.base.pprev = &alarm.base.next;
+    TEST_ASSERT(!ztimer_is_set(z, &garbage));
+    TEST_ASSERT(!ztimer_remove(z, &garbage));
+    TEST_ASSERT(alarm.base.next == NULL);
+    TEST_ASSERT(ztimer_is_set(z, &alarm));
+
+    garbage.callback = cb_incr;
+    garbage.arg = &count;
+    ztimer_set(z, &garbage, 50);
+    TEST_ASSERT(ztimer_is_set(z, &garbage));
+    ztimer_mock_advance(&zmock, 50);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(!ztimer_is_set(z, &garbage));
+    ztimer_mock_advance(&zmock, 50);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT(ztimer_wheel_is_empty(&wheel));
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_targets),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_wrap),
+        new_TestFixture(test_ztimer_wheel_uninitialized),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_wheel_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_wheel_tests;
+}
+
+/** @} */